@@ -46,6 +46,7 @@ namespace catapult { namespace diagnostics {
 			handlers.setAllowedHosts(state.config().Node.TrustedHosts);
 
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
+			handlers::RegisterDiagnosticLatenciesHandler(handlers, state.latencyHistograms());
 			handlers::RegisterDiagnosticNodesHandler(handlers, state.nodes());
 			handlers::RegisterDiagnosticBlockStatementHandler(handlers, state.storage());
 			state.pluginManager().addDiagnosticHandlers(handlers, state.cache());
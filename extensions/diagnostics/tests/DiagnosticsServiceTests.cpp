@@ -20,6 +20,8 @@
 
 #include "diagnostics/src/DiagnosticsService.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticLatencyValue.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
 #include "tests/test/local/ServiceTestUtils.h"
@@ -67,9 +69,10 @@ namespace catapult { namespace diagnostics {
 		context.boot();
 		const auto& packetHandlers = context.testState().state().packetHandlers();
 
-		// Assert: three default handlers were added
-		EXPECT_EQ(4u, packetHandlers.size());
+		// Assert: four default handlers were added
+		EXPECT_EQ(5u, packetHandlers.size());
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Counters)); // the default (counters) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Latencies)); // the default (latencies) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Infos)); // the default (nodes) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Block_Statement)); // the default (statements) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Chain_Info)); // the diagnostic handler hook registered above
@@ -155,4 +158,30 @@ namespace catapult { namespace diagnostics {
 		EXPECT_EQ(Num_Counters, actualCounterNames.size());
 		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), actualCounterNames);
 	}
+
+	TEST(TEST_CLASS, LatenciesAreSourcedFromStateRegistry) {
+		// Arrange: add histograms before and after boot
+		TestContext context;
+		auto& registry = context.testState().latencyHistograms();
+		registry.add("ALPHA", 0, std::make_shared<utils::LatencyHistogram>());
+
+		// Act:
+		context.boot();
+		registry.add("BETA", 1, std::make_shared<utils::LatencyHistogram>());
+		const auto& packetHandlers = context.testState().state().packetHandlers();
+
+		// - process a latencies request
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Latencies;
+		ionet::ServerPacketHandlerContext handlerContext({}, "");
+		EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+
+		// Assert: header is correct and contains all registered histograms
+		auto expectedPacketSize = sizeof(ionet::PacketHeader) + 2 * sizeof(model::DiagnosticLatencyValue);
+		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Latencies);
+
+		const auto* pLatencyValue = reinterpret_cast<const model::DiagnosticLatencyValue*>(test::GetSingleBufferData(handlerContext));
+		EXPECT_EQ("ALPHA", utils::DiagnosticCounterId(pLatencyValue[0].Id).name());
+		EXPECT_EQ("BETA", utils::DiagnosticCounterId(pLatencyValue[1].Id).name());
+	}
 }}
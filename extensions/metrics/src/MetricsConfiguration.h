@@ -0,0 +1,56 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/TimeSpan.h"
+#include <boost/filesystem/path.hpp>
+#include <string>
+
+namespace catapult { namespace utils { class ConfigurationBag; } }
+
+namespace catapult { namespace metrics {
+
+	/// Metrics configuration settings.
+	struct MetricsConfiguration {
+	public:
+		/// Metrics server port.
+		unsigned short Port;
+
+		/// Interface the metrics server listens on.
+		std::string ListenInterface;
+
+		/// Duration for which a rendered metrics snapshot is reused.
+		utils::TimeSpan SnapshotDuration;
+
+	private:
+		MetricsConfiguration() = default;
+
+	public:
+		/// Creates an uninitialized metrics configuration.
+		static MetricsConfiguration Uninitialized();
+
+	public:
+		/// Loads a metrics configuration from \a bag.
+		static MetricsConfiguration LoadFromBag(const utils::ConfigurationBag& bag);
+
+		/// Loads a metrics configuration from \a resourcesPath.
+		static MetricsConfiguration LoadFromPath(const boost::filesystem::path& resourcesPath);
+	};
+}}
@@ -0,0 +1,107 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsFormatter.h"
+#include <cctype>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace catapult { namespace metrics {
+
+	namespace {
+		constexpr auto Metric_Prefix = "catapult_";
+	}
+
+	std::string ToMetricName(const std::string& name) {
+		std::string metricName = Metric_Prefix;
+		for (auto ch : name)
+			metricName.push_back(' ' == ch ? '_' : static_cast<char>(std::tolower(ch)));
+
+		return metricName;
+	}
+
+	namespace {
+		void FormatCounters(std::ostream& out, const std::vector<utils::DiagnosticCounter>& counters) {
+			for (const auto& counter : counters) {
+				auto metricName = ToMetricName(counter.id().name());
+				out << "# TYPE " << metricName << " gauge" << std::endl;
+				out << metricName << " " << counter.value() << std::endl;
+			}
+		}
+
+		void FormatLatencies(std::ostream& out, const std::vector<utils::LatencyHistogramRegistry::Entry>& latencyEntries) {
+			// group histograms by name so that each metric family is output contiguously
+			std::map<std::string, std::vector<const utils::LatencyHistogramRegistry::Entry*>> groupedEntries;
+			for (const auto& entry : latencyEntries)
+				groupedEntries[ToMetricName(entry.Id.name()) + "_micros"].push_back(&entry);
+
+			for (const auto& pair : groupedEntries) {
+				const auto& metricName = pair.first;
+				out << "# TYPE " << metricName << " summary" << std::endl;
+				for (const auto* pEntry : pair.second) {
+					const auto& histogram = *pEntry->pHistogram;
+					auto label = "{index=\"" + std::to_string(pEntry->Index) + "\"";
+					out << metricName << label << ",quantile=\"0.5\"} " << histogram.percentile(50) << std::endl;
+					out << metricName << label << ",quantile=\"0.99\"} " << histogram.percentile(99) << std::endl;
+					out << metricName << "_count" << label << "} " << histogram.count() << std::endl;
+				}
+
+				out << "# TYPE " << metricName << "_max gauge" << std::endl;
+				for (const auto* pEntry : pair.second)
+					out << metricName << "_max{index=\"" << pEntry->Index << "\"} " << pEntry->pHistogram->max() << std::endl;
+			}
+		}
+	}
+
+	std::string FormatMetrics(
+			const std::vector<utils::DiagnosticCounter>& counters,
+			const std::vector<utils::LatencyHistogramRegistry::Entry>& latencyEntries) {
+		std::ostringstream out;
+		FormatCounters(out, counters);
+		FormatLatencies(out, latencyEntries);
+		return out.str();
+	}
+
+	supplier<std::string> CreateCachingMetricsSupplier(
+			const supplier<std::string>& renderer,
+			const supplier<Timestamp>& timeSupplier,
+			const utils::TimeSpan& snapshotDuration) {
+		struct SnapshotState {
+			std::mutex Mutex;
+			bool HasSnapshot = false;
+			Timestamp SnapshotTime;
+			std::string Snapshot;
+		};
+
+		auto pState = std::make_shared<SnapshotState>();
+		return [renderer, timeSupplier, snapshotDuration, pState]() {
+			std::lock_guard<std::mutex> guard(pState->Mutex);
+			auto now = timeSupplier();
+			if (!pState->HasSnapshot || now < pState->SnapshotTime || now - pState->SnapshotTime >= Timestamp(snapshotDuration.millis())) {
+				pState->Snapshot = renderer();
+				pState->SnapshotTime = now;
+				pState->HasSnapshot = true;
+			}
+
+			return pState->Snapshot;
+		};
+	}
+}}
@@ -0,0 +1,47 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include <string>
+#include <vector>
+
+namespace catapult { namespace metrics {
+
+	/// Converts a diagnostic counter \a name into a prometheus metric name.
+	std::string ToMetricName(const std::string& name);
+
+	/// Formats \a counters and \a latencyEntries using the prometheus text exposition format.
+	/// \note Counters are exported as gauges and latency histograms are exported as summaries (in microseconds).
+	std::string FormatMetrics(
+			const std::vector<utils::DiagnosticCounter>& counters,
+			const std::vector<utils::LatencyHistogramRegistry::Entry>& latencyEntries);
+
+	/// Creates a supplier that returns the last result of \a renderer as long as it is not older than \a snapshotDuration
+	/// according to \a timeSupplier.
+	supplier<std::string> CreateCachingMetricsSupplier(
+			const supplier<std::string>& renderer,
+			const supplier<Timestamp>& timeSupplier,
+			const utils::TimeSpan& snapshotDuration);
+}}
@@ -0,0 +1,209 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsServer.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/WeakContainer.h"
+#include <boost/asio.hpp>
+#include <sstream>
+
+namespace catapult { namespace metrics {
+
+	namespace {
+		constexpr size_t Max_Request_Header_Size = 4 * 1024;
+
+		std::string CreateResponse(const std::string& status, const std::string& contentType, const std::string& body) {
+			std::ostringstream out;
+			out
+					<< "HTTP/1.1 " << status << "\r\n"
+					<< "Content-Type: " << contentType << "\r\n"
+					<< "Content-Length: " << body.size() << "\r\n"
+					<< "Connection: close\r\n"
+					<< "\r\n"
+					<< body;
+			return out.str();
+		}
+
+		bool IsMetricsRequest(const std::string& requestLine) {
+			std::istringstream in(requestLine);
+			std::string method;
+			std::string target;
+			in >> method >> target;
+			return "GET" == method && "/metrics" == target;
+		}
+
+		// region MetricsConnection
+
+		class MetricsConnection : public std::enable_shared_from_this<MetricsConnection> {
+		public:
+			MetricsConnection(boost::asio::io_context& ioContext, const supplier<std::string>& metricsSupplier)
+					: m_socket(ioContext)
+					, m_metricsSupplier(metricsSupplier)
+					, m_buffer(Max_Request_Header_Size)
+			{}
+
+		public:
+			boost::asio::ip::tcp::socket& socket() {
+				return m_socket;
+			}
+
+		public:
+			void start() {
+				boost::asio::async_read_until(m_socket, m_buffer, "\r\n\r\n", [pThis = shared_from_this()](
+						const auto& ec,
+						auto) {
+					pThis->handleRead(ec);
+				});
+			}
+
+			void close() {
+				boost::asio::post(m_socket.get_executor(), [pThis = shared_from_this()]() {
+					boost::system::error_code ignored_ec;
+					pThis->m_socket.close(ignored_ec);
+				});
+			}
+
+		private:
+			void handleRead(const boost::system::error_code& ec) {
+				if (ec) {
+					CATAPULT_LOG(debug) << "metrics request read failed: " << ec.message();
+					return;
+				}
+
+				std::istream in(&m_buffer);
+				std::string requestLine;
+				std::getline(in, requestLine);
+
+				m_response = IsMetricsRequest(requestLine)
+						? CreateResponse("200 OK", "text/plain; version=0.0.4", m_metricsSupplier())
+						: CreateResponse("404 Not Found", "text/plain", "not found\n");
+
+				boost::asio::async_write(m_socket, boost::asio::buffer(m_response), [pThis = shared_from_this()](
+						const auto&,
+						auto) {
+					boost::system::error_code ignored_ec;
+					pThis->m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored_ec);
+					pThis->m_socket.close(ignored_ec);
+				});
+			}
+
+		private:
+			boost::asio::ip::tcp::socket m_socket;
+			supplier<std::string> m_metricsSupplier;
+			boost::asio::streambuf m_buffer;
+			std::string m_response;
+		};
+
+		// endregion
+
+		// region DefaultMetricsServer
+
+		class DefaultMetricsServer
+				: public MetricsServer
+				, public std::enable_shared_from_this<DefaultMetricsServer> {
+		public:
+			DefaultMetricsServer(
+					const std::shared_ptr<thread::IoThreadPool>& pPool,
+					const boost::asio::ip::tcp::endpoint& endpoint,
+					const supplier<std::string>& metricsSupplier)
+					: m_pPool(pPool)
+					, m_metricsSupplier(metricsSupplier)
+					, m_acceptorStrand(pPool->ioContext())
+					, m_acceptor(pPool->ioContext())
+					, m_connections([](auto& connection) { connection.close(); })
+					, m_isStopped(false) {
+				m_acceptor.open(endpoint.protocol());
+				m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+				m_acceptor.bind(endpoint);
+				m_acceptor.listen();
+				CATAPULT_LOG(info) << "metrics server listening on " << endpoint;
+			}
+
+		public:
+			size_t numActiveConnections() const override {
+				return m_connections.size();
+			}
+
+		public:
+			void start() {
+				boost::asio::post(m_acceptorStrand, [pThis = shared_from_this()]() {
+					pThis->startAccept();
+				});
+			}
+
+			void shutdown() override {
+				boost::asio::post(m_acceptorStrand, [pThis = shared_from_this()]() {
+					pThis->m_isStopped = true;
+
+					boost::system::error_code ignored_ec;
+					pThis->m_acceptor.close(ignored_ec);
+				});
+
+				m_connections.clear();
+			}
+
+		private:
+			void startAccept() {
+				if (m_isStopped)
+					return;
+
+				auto pConnection = std::make_shared<MetricsConnection>(m_pPool->ioContext(), m_metricsSupplier);
+				m_acceptor.async_accept(pConnection->socket(), boost::asio::bind_executor(m_acceptorStrand, [
+						pThis = shared_from_this(),
+						pConnection](const auto& ec) {
+					pThis->handleAccept(ec, pConnection);
+				}));
+			}
+
+			void handleAccept(const boost::system::error_code& ec, const std::shared_ptr<MetricsConnection>& pConnection) {
+				if (ec) {
+					CATAPULT_LOG(debug) << "metrics server accept failed: " << ec.message();
+					if (boost::asio::error::operation_aborted == ec)
+						return;
+				} else {
+					m_connections.insert(pConnection);
+					pConnection->start();
+				}
+
+				startAccept();
+			}
+
+		private:
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
+			supplier<std::string> m_metricsSupplier;
+			boost::asio::io_context::strand m_acceptorStrand;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			utils::WeakContainer<MetricsConnection> m_connections;
+			bool m_isStopped;
+		};
+
+		// endregion
+	}
+
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const supplier<std::string>& metricsSupplier) {
+		auto pServer = std::make_shared<DefaultMetricsServer>(pPool, endpoint, metricsSupplier);
+		pServer->start();
+		return pServer;
+	}
+}}
@@ -0,0 +1,52 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include <boost/asio/ip/tcp.hpp>
+#include <memory>
+#include <string>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace metrics {
+
+	/// A minimal http server that exposes metrics for scraping.
+	/// \note Only \c GET requests for \c /metrics are supported; all other requests are rejected with \c 404.
+	class MetricsServer {
+	public:
+		virtual ~MetricsServer() = default;
+
+	public:
+		/// Gets the number of currently open connections.
+		virtual size_t numActiveConnections() const = 0;
+
+	public:
+		/// Shuts down the server.
+		virtual void shutdown() = 0;
+	};
+
+	/// Creates a metrics server listening on \a endpoint using \a pPool that returns the result of \a metricsSupplier
+	/// to all metrics requests.
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const supplier<std::string>& metricsSupplier);
+}}
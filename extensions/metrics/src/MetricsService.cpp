@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsService.h"
+#include "MetricsConfiguration.h"
+#include "MetricsFormatter.h"
+#include "MetricsServer.h"
+#include "catapult/extensions/ServiceLocator.h"
+#include "catapult/extensions/ServiceState.h"
+#include "catapult/thread/MultiServicePool.h"
+
+namespace catapult { namespace metrics {
+
+	namespace {
+		constexpr auto Service_Name = "metrics";
+
+		std::vector<utils::DiagnosticCounter> CreatePoolCounters(const thread::MultiServicePool& pool) {
+			// the io context does not expose its queue depth, so export pool dimensions instead
+			std::vector<utils::DiagnosticCounter> counters;
+			counters.emplace_back(utils::DiagnosticCounterId("POOL WORKERS"), [&pool]() { return pool.numWorkerThreads(); });
+			counters.emplace_back(utils::DiagnosticCounterId("POOL GROUPS"), [&pool]() { return pool.numServiceGroups(); });
+			return counters;
+		}
+
+		class MetricsServiceRegistrar : public extensions::ServiceRegistrar {
+		public:
+			explicit MetricsServiceRegistrar(const MetricsConfiguration& metricsConfig) : m_metricsConfig(metricsConfig)
+			{}
+
+		public:
+			extensions::ServiceRegistrarInfo info() const override {
+				return { "Metrics", extensions::ServiceRegistrarPhase::Post_Packet_Handlers };
+			}
+
+			void registerServiceCounters(extensions::ServiceLocator& locator) override {
+				locator.registerServiceCounter<MetricsServer>(Service_Name, "METRICS CONNS", [](const auto& server) {
+					return server.numActiveConnections();
+				});
+			}
+
+			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
+				// merge all counters
+				auto counters = state.counters();
+				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
+
+				auto poolCounters = CreatePoolCounters(state.pool());
+				counters.insert(counters.end(), poolCounters.cbegin(), poolCounters.cend());
+
+				// latency histograms are read at render time because more can be added after this service is registered
+				const auto& latencyHistograms = state.latencyHistograms();
+				auto metricsSupplier = CreateCachingMetricsSupplier(
+						[counters, &latencyHistograms]() { return FormatMetrics(counters, latencyHistograms.entries()); },
+						state.timeSupplier(),
+						m_metricsConfig.SnapshotDuration);
+
+				auto endpoint = boost::asio::ip::tcp::endpoint(
+						boost::asio::ip::make_address(m_metricsConfig.ListenInterface),
+						m_metricsConfig.Port);
+				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
+				auto pServer = pServiceGroup->pushService(CreateMetricsServer, endpoint, metricsSupplier);
+				locator.registerService(Service_Name, pServer);
+			}
+
+		private:
+			MetricsConfiguration m_metricsConfig;
+		};
+	}
+
+	DECLARE_SERVICE_REGISTRAR(Metrics)(const MetricsConfiguration& metricsConfig) {
+		return std::make_unique<MetricsServiceRegistrar>(metricsConfig);
+	}
+}}
@@ -0,0 +1,86 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsConfiguration.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace metrics {
+
+#define TEST_CLASS MetricsConfigurationTests
+
+	namespace {
+		struct MetricsConfigurationTraits {
+			using ConfigurationType = MetricsConfiguration;
+
+			static utils::ConfigurationBag::ValuesContainer CreateProperties() {
+				return {
+					{
+						"metrics",
+						{
+							{ "port", "9753" },
+							{ "listenInterface", "1.2.3.4" },
+							{ "snapshotDuration", "17s" }
+						}
+					}
+				};
+			}
+
+			static bool IsSectionOptional(const std::string&) {
+				return false;
+			}
+
+			static void AssertZero(const MetricsConfiguration& config) {
+				// Assert:
+				EXPECT_EQ(0u, config.Port);
+				EXPECT_EQ("", config.ListenInterface);
+				EXPECT_EQ(utils::TimeSpan(), config.SnapshotDuration);
+			}
+
+			static void AssertCustom(const MetricsConfiguration& config) {
+				// Assert:
+				EXPECT_EQ(9753u, config.Port);
+				EXPECT_EQ("1.2.3.4", config.ListenInterface);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(17), config.SnapshotDuration);
+			}
+		};
+	}
+
+	DEFINE_CONFIGURATION_TESTS(TEST_CLASS, Metrics)
+
+	// region file io
+
+	TEST(TEST_CLASS, LoadFromPathFailsWhenFileDoesNotExist) {
+		// Act + Assert: attempt to load the config
+		EXPECT_THROW(MetricsConfiguration::LoadFromPath("../no-resources"), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanLoadConfigFromResourcesDirectory) {
+		// Act: attempt to load from the "real" resources directory
+		auto config = MetricsConfiguration::LoadFromPath("../resources");
+
+		// Assert:
+		EXPECT_EQ(7904u, config.Port);
+		EXPECT_EQ("127.0.0.1", config.ListenInterface);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(1), config.SnapshotDuration);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,207 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsFormatter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace metrics {
+
+#define TEST_CLASS MetricsFormatterTests
+
+	// region ToMetricName
+
+	TEST(TEST_CLASS, ToMetricNameAddsPrefixAndNormalizesName) {
+		EXPECT_EQ("catapult_", ToMetricName(""));
+		EXPECT_EQ("catapult_alpha", ToMetricName("ALPHA"));
+		EXPECT_EQ("catapult_ut_cache", ToMetricName("UT CACHE"));
+		EXPECT_EQ("catapult_blk_elem_lat", ToMetricName("BLK ELEM LAT"));
+	}
+
+	// endregion
+
+	// region FormatMetrics
+
+	namespace {
+		std::shared_ptr<utils::LatencyHistogram> CreateHistogram(std::initializer_list<uint64_t> values) {
+			auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+			for (auto value : values)
+				pHistogram->record(value);
+
+			return pHistogram;
+		}
+	}
+
+	TEST(TEST_CLASS, CanFormatNoMetrics) {
+		// Act:
+		auto metrics = FormatMetrics({}, {});
+
+		// Assert:
+		EXPECT_EQ("", metrics);
+	}
+
+	TEST(TEST_CLASS, CanFormatCountersAsGauges) {
+		// Arrange:
+		std::vector<utils::DiagnosticCounter> counters;
+		counters.emplace_back(utils::DiagnosticCounterId("ALPHA"), []() { return 123u; });
+		counters.emplace_back(utils::DiagnosticCounterId("BETA GAMMA"), []() { return 8u; });
+
+		// Act:
+		auto metrics = FormatMetrics(counters, {});
+
+		// Assert:
+		std::string expectedMetrics =
+				"# TYPE catapult_alpha gauge\n"
+				"catapult_alpha 123\n"
+				"# TYPE catapult_beta_gamma gauge\n"
+				"catapult_beta_gamma 8\n";
+		EXPECT_EQ(expectedMetrics, metrics);
+	}
+
+	TEST(TEST_CLASS, CanFormatLatenciesAsSummariesGroupedByName) {
+		// Arrange:
+		std::vector<utils::LatencyHistogramRegistry::Entry> entries{
+			{ utils::DiagnosticCounterId("BETA"), 0, CreateHistogram({ 7 }) },
+			{ utils::DiagnosticCounterId("ALPHA"), 2, CreateHistogram({ 3, 3, 3 }) },
+			{ utils::DiagnosticCounterId("BETA"), 1, CreateHistogram({}) }
+		};
+
+		// Act:
+		auto metrics = FormatMetrics({}, entries);
+
+		// Assert:
+		std::string expectedMetrics =
+				"# TYPE catapult_alpha_micros summary\n"
+				"catapult_alpha_micros{index=\"2\",quantile=\"0.5\"} 3\n"
+				"catapult_alpha_micros{index=\"2\",quantile=\"0.99\"} 3\n"
+				"catapult_alpha_micros_count{index=\"2\"} 3\n"
+				"# TYPE catapult_alpha_micros_max gauge\n"
+				"catapult_alpha_micros_max{index=\"2\"} 3\n"
+				"# TYPE catapult_beta_micros summary\n"
+				"catapult_beta_micros{index=\"0\",quantile=\"0.5\"} 7\n"
+				"catapult_beta_micros{index=\"0\",quantile=\"0.99\"} 7\n"
+				"catapult_beta_micros_count{index=\"0\"} 1\n"
+				"catapult_beta_micros{index=\"1\",quantile=\"0.5\"} 0\n"
+				"catapult_beta_micros{index=\"1\",quantile=\"0.99\"} 0\n"
+				"catapult_beta_micros_count{index=\"1\"} 0\n"
+				"# TYPE catapult_beta_micros_max gauge\n"
+				"catapult_beta_micros_max{index=\"0\"} 7\n"
+				"catapult_beta_micros_max{index=\"1\"} 0\n";
+		EXPECT_EQ(expectedMetrics, metrics);
+	}
+
+	TEST(TEST_CLASS, CanFormatCountersAndLatencies) {
+		// Arrange:
+		std::vector<utils::DiagnosticCounter> counters;
+		counters.emplace_back(utils::DiagnosticCounterId("ALPHA"), []() { return 5u; });
+		std::vector<utils::LatencyHistogramRegistry::Entry> entries{ { utils::DiagnosticCounterId("BETA"), 0, CreateHistogram({ 4 }) } };
+
+		// Act:
+		auto metrics = FormatMetrics(counters, entries);
+
+		// Assert:
+		std::string expectedMetrics =
+				"# TYPE catapult_alpha gauge\n"
+				"catapult_alpha 5\n"
+				"# TYPE catapult_beta_micros summary\n"
+				"catapult_beta_micros{index=\"0\",quantile=\"0.5\"} 4\n"
+				"catapult_beta_micros{index=\"0\",quantile=\"0.99\"} 4\n"
+				"catapult_beta_micros_count{index=\"0\"} 1\n"
+				"# TYPE catapult_beta_micros_max gauge\n"
+				"catapult_beta_micros_max{index=\"0\"} 4\n";
+		EXPECT_EQ(expectedMetrics, metrics);
+	}
+
+	// endregion
+
+	// region CreateCachingMetricsSupplier
+
+	namespace {
+		struct CachingSupplierContext {
+		public:
+			CachingSupplierContext() : NumRenders(0), Time(1000) {
+				Supplier = CreateCachingMetricsSupplier(
+						[this]() { return "render " + std::to_string(++NumRenders); },
+						[this]() { return Time; },
+						utils::TimeSpan::FromMilliseconds(100));
+			}
+
+		public:
+			size_t NumRenders;
+			Timestamp Time;
+			supplier<std::string> Supplier;
+		};
+	}
+
+	TEST(TEST_CLASS, CachingSupplierRendersOnFirstAccess) {
+		// Arrange:
+		CachingSupplierContext context;
+
+		// Act:
+		auto metrics = context.Supplier();
+
+		// Assert:
+		EXPECT_EQ("render 1", metrics);
+		EXPECT_EQ(1u, context.NumRenders);
+	}
+
+	TEST(TEST_CLASS, CachingSupplierReusesSnapshotWithinSnapshotDuration) {
+		// Arrange:
+		CachingSupplierContext context;
+		context.Supplier();
+
+		// Act:
+		context.Time = Timestamp(1099);
+		auto metrics = context.Supplier();
+
+		// Assert:
+		EXPECT_EQ("render 1", metrics);
+		EXPECT_EQ(1u, context.NumRenders);
+	}
+
+	TEST(TEST_CLASS, CachingSupplierRendersWhenSnapshotExpires) {
+		// Arrange:
+		CachingSupplierContext context;
+		context.Supplier();
+
+		// Act:
+		context.Time = Timestamp(1100);
+		auto metrics = context.Supplier();
+
+		// Assert:
+		EXPECT_EQ("render 2", metrics);
+		EXPECT_EQ(2u, context.NumRenders);
+	}
+
+	TEST(TEST_CLASS, CachingSupplierRendersWhenTimeMovesBackwards) {
+		// Arrange:
+		CachingSupplierContext context;
+		context.Supplier();
+
+		// Act:
+		context.Time = Timestamp(999);
+		auto metrics = context.Supplier();
+
+		// Assert:
+		EXPECT_EQ("render 2", metrics);
+		EXPECT_EQ(2u, context.NumRenders);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,115 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsServer.h"
+#include "metrics/tests/test/MetricsTestUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace metrics {
+
+#define TEST_CLASS MetricsServerTests
+
+	namespace {
+		class ServerTestContext {
+		public:
+			explicit ServerTestContext(const std::string& metrics)
+					: m_pPool(test::CreateStartedIoThreadPool())
+					, m_numRequests(0)
+					, m_pServer(CreateMetricsServer(m_pPool, test::CreateLocalHostEndpoint(), [this, metrics]() {
+						++m_numRequests;
+						return metrics;
+					}))
+			{}
+
+			~ServerTestContext() {
+				m_pServer->shutdown();
+				m_pServer.reset();
+				m_pPool->join();
+			}
+
+		public:
+			size_t numRequests() const {
+				return m_numRequests;
+			}
+
+			const auto& server() const {
+				return *m_pServer;
+			}
+
+		private:
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
+			std::atomic<size_t> m_numRequests;
+			std::shared_ptr<MetricsServer> m_pServer;
+		};
+	}
+
+	TEST(TEST_CLASS, ServerInitiallyHasNoActiveConnections) {
+		// Act:
+		ServerTestContext context("alpha 1\n");
+
+		// Assert:
+		EXPECT_EQ(0u, context.server().numActiveConnections());
+		EXPECT_EQ(0u, context.numRequests());
+	}
+
+	TEST(TEST_CLASS, ServerRespondsToMetricsRequest) {
+		// Arrange:
+		ServerTestContext context("alpha 1\nbeta 2\n");
+
+		// Act:
+		auto response = test::SendHttpGetRequest(test::GetLocalHostPort(), "/metrics");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", response.StatusLine);
+		EXPECT_EQ("alpha 1\nbeta 2\n", response.Body);
+		EXPECT_EQ(1u, context.numRequests());
+	}
+
+	TEST(TEST_CLASS, ServerCanRespondToMultipleMetricsRequests) {
+		// Arrange:
+		ServerTestContext context("alpha 1\n");
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			auto response = test::SendHttpGetRequest(test::GetLocalHostPort(), "/metrics");
+
+			// Assert:
+			EXPECT_EQ("HTTP/1.1 200 OK", response.StatusLine) << i;
+			EXPECT_EQ("alpha 1\n", response.Body) << i;
+		}
+
+		EXPECT_EQ(3u, context.numRequests());
+	}
+
+	TEST(TEST_CLASS, ServerRejectsUnknownTarget) {
+		// Arrange:
+		ServerTestContext context("alpha 1\n");
+
+		// Act:
+		auto response = test::SendHttpGetRequest(test::GetLocalHostPort(), "/status");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 404 Not Found", response.StatusLine);
+		EXPECT_EQ(0u, context.numRequests());
+	}
+}}
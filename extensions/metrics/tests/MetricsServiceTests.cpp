@@ -0,0 +1,126 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsService.h"
+#include "metrics/src/MetricsConfiguration.h"
+#include "metrics/tests/test/MetricsTestUtils.h"
+#include "tests/test/local/ServiceLocatorTestContext.h"
+#include "tests/test/local/ServiceTestUtils.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace metrics {
+
+#define TEST_CLASS MetricsServiceTests
+
+	namespace {
+		constexpr auto Service_Name = "metrics";
+		constexpr auto Connections_Counter_Name = "METRICS CONNS";
+
+		struct MetricsServiceTraits {
+			static auto CreateRegistrar() {
+				auto config = MetricsConfiguration::Uninitialized();
+				config.Port = test::GetLocalHostPort();
+				config.ListenInterface = "127.0.0.1";
+				config.SnapshotDuration = utils::TimeSpan::FromMilliseconds(0);
+				return CreateMetricsServiceRegistrar(config);
+			}
+		};
+
+		using TestContext = test::ServiceLocatorTestContext<MetricsServiceTraits>;
+
+		bool Contains(const std::string& metrics, const std::string& line) {
+			return std::string::npos != metrics.find(line + "\n");
+		}
+	}
+
+	ADD_SERVICE_REGISTRAR_INFO_TEST(Metrics, Post_Packet_Handlers)
+
+	TEST(TEST_CLASS, CanBootService) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(1u, context.locator().numServices());
+		EXPECT_EQ(1u, context.locator().counters().size());
+
+		EXPECT_TRUE(!!context.locator().service<MetricsServer>(Service_Name));
+		EXPECT_EQ(0u, context.counter(Connections_Counter_Name));
+	}
+
+	TEST(TEST_CLASS, CanShutdownService) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+		context.shutdown();
+
+		// Assert:
+		EXPECT_EQ(1u, context.locator().numServices());
+		EXPECT_EQ(1u, context.locator().counters().size());
+
+		EXPECT_FALSE(!!context.locator().service<MetricsServer>(Service_Name));
+		EXPECT_EQ(extensions::ServiceLocator::Sentinel_Counter_Value, context.counter(Connections_Counter_Name));
+	}
+
+	TEST(TEST_CLASS, ServiceExportsStateCountersServiceCountersPoolCountersAndLatencies) {
+		// Arrange:
+		TestContext context;
+		context.testState().counters().emplace_back(utils::DiagnosticCounterId("ALPHA"), []() { return 17u; });
+
+		auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+		pHistogram->record(12);
+		context.testState().latencyHistograms().add("BETA", 3, pHistogram);
+
+		context.boot();
+
+		// Act:
+		auto response = test::SendHttpGetRequest(test::GetLocalHostPort(), "/metrics");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", response.StatusLine);
+		EXPECT_TRUE(Contains(response.Body, "catapult_alpha 17")) << response.Body;
+		EXPECT_TRUE(Contains(response.Body, "catapult_metrics_conns 1")) << response.Body;
+		EXPECT_TRUE(Contains(response.Body, "catapult_pool_workers 2")) << response.Body;
+		EXPECT_TRUE(Contains(response.Body, "catapult_pool_groups 1")) << response.Body;
+		EXPECT_TRUE(Contains(response.Body, "catapult_beta_micros_count{index=\"3\"} 1")) << response.Body;
+		EXPECT_TRUE(Contains(response.Body, "catapult_beta_micros_max{index=\"3\"} 12")) << response.Body;
+	}
+
+	TEST(TEST_CLASS, ServiceExportsLatenciesAddedAfterBoot) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+		context.testState().latencyHistograms().add("GAMMA", 0, pHistogram);
+
+		// Act:
+		auto response = test::SendHttpGetRequest(test::GetLocalHostPort(), "/metrics");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", response.StatusLine);
+		EXPECT_TRUE(Contains(response.Body, "catapult_gamma_micros_count{index=\"0\"} 0")) << response.Body;
+	}
+}}
@@ -0,0 +1,52 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsTestUtils.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include <boost/asio.hpp>
+#include <sstream>
+
+namespace catapult { namespace test {
+
+	HttpResponse SendHttpGetRequest(unsigned short port, const std::string& target) {
+		boost::asio::io_context ioContext;
+		boost::asio::ip::tcp::socket socket(ioContext);
+		socket.connect(CreateLocalHostEndpoint(port));
+
+		auto request = "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+		boost::asio::write(socket, boost::asio::buffer(request));
+
+		// server closes the connection after writing the response
+		boost::asio::streambuf buffer;
+		boost::system::error_code ec;
+		boost::asio::read(socket, buffer, ec);
+
+		std::string response((std::istreambuf_iterator<char>(&buffer)), std::istreambuf_iterator<char>());
+		auto statusLineEnd = response.find("\r\n");
+		auto headersEnd = response.find("\r\n\r\n");
+
+		HttpResponse httpResponse;
+		httpResponse.StatusLine = response.substr(0, statusLineEnd);
+		if (std::string::npos != headersEnd)
+			httpResponse.Body = response.substr(headersEnd + 4);
+
+		return httpResponse;
+	}
+}}
@@ -0,0 +1,37 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <string>
+
+namespace catapult { namespace test {
+
+	/// Http response returned by a metrics server.
+	struct HttpResponse {
+		/// Status line.
+		std::string StatusLine;
+
+		/// Response body.
+		std::string Body;
+	};
+
+	/// Sends a blocking \c GET request for \a target to the local host server listening on \a port.
+	HttpResponse SendHttpGetRequest(unsigned short port, const std::string& target);
+}}
@@ -96,10 +96,11 @@ namespace catapult { namespace partialtransaction {
 			{}
 
 		public:
-			void addHashConsumers(const cache::MemoryPtCacheProxy& ptCache) {
+			void addHashConsumers(const cache::MemoryPtCacheProxy& ptCache, const std::shared_ptr<thread::IoThreadPool>& pHashPool) {
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHash,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pHashPool));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
@@ -215,9 +216,10 @@ namespace catapult { namespace partialtransaction {
 			state.tasks().push_back(extensions::CreateBatchTransactionTask(*pBatchRangeDispatcher, "partial transaction"));
 		}
 
-		std::unique_ptr<chain::PtUpdater> CreateAndRegisterPtUpdater(cache::MemoryPtCacheProxy& ptCache, extensions::ServiceState& state) {
-			auto pUpdaterPool = state.pool().pushIsolatedPool("ptUpdater");
-
+		std::unique_ptr<chain::PtUpdater> CreateAndRegisterPtUpdater(
+				cache::MemoryPtCacheProxy& ptCache,
+				const std::shared_ptr<thread::IoThreadPool>& pUpdaterPool,
+				extensions::ServiceState& state) {
 			// validator needs to be created here because bootstrapper does not have cache nor all validators registered
 			auto pValidator = chain::CreatePtValidator(state.cache(), state.timeSupplier(), state.pluginManager());
 
@@ -245,16 +247,19 @@ namespace catapult { namespace partialtransaction {
 
 			void registerServices(ServiceLocator& locator, ServiceState& state) override {
 				// partial transaction updater
+				// (updater pool is shared with hash calculator consumer, which waits for its work on dispatcher thread)
 				auto& ptCache = GetMemoryPtCache(locator);
-				auto pPtUpdater = CreateAndRegisterPtUpdater(ptCache, state);
+				auto pUpdaterPool = state.pool().pushIsolatedPool("ptUpdater");
+				auto pPtUpdater = CreateAndRegisterPtUpdater(ptCache, pUpdaterPool, state);
 
 				// partial transaction dispatcher
 				auto pServiceGroup = state.pool().pushServiceGroup("partial dispatcher");
 				TransactionDispatcherBuilder dispatcherBuilder(state);
-				dispatcherBuilder.addHashConsumers(ptCache);
+				dispatcherBuilder.addHashConsumers(ptCache, pUpdaterPool);
 
 				auto pDispatcher = dispatcherBuilder.build(*pPtUpdater, CreateNewTransactionSink(locator));
 				RegisterTransactionDispatcherService(pDispatcher, *pPtUpdater, locator, state);
+				extensions::AddDispatcherLatencies(state.latencyHistograms(), *pDispatcher, "PT");
 
 				// extend the lifetimes of pDispatcher and pPtUpdater
 				pServiceGroup->registerService(std::make_shared<DispatcherServiceRegistrar>(pDispatcher, std::move(pPtUpdater)));
@@ -205,6 +205,14 @@ namespace catapult { namespace partialtransaction {
 		EXPECT_EQ(3u, pDispatcher->size());
 		EXPECT_TRUE(pDispatcher->isRunning());
 
+		// - consumer latencies should be registered
+		auto latencyEntries = context.testState().latencyHistograms().entries();
+		ASSERT_EQ(3u, latencyEntries.size());
+		for (auto i = 0u; i < latencyEntries.size(); ++i) {
+			EXPECT_EQ("PT ELEM LAT", latencyEntries[i].Id.name()) << i;
+			EXPECT_EQ(i, latencyEntries[i].Index) << i;
+		}
+
 		// - nothing was broadcasted
 		EXPECT_EQ(0u, context.numBroadcastCalls());
 
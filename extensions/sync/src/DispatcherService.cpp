@@ -22,6 +22,7 @@
 #include "DispatcherSyncHandlers.h"
 #include "PredicateUtils.h"
 #include "RollbackInfo.h"
+#include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockStatisticCache.h"
@@ -38,6 +39,8 @@
 #include "catapult/consumers/ReclaimMemoryInspector.h"
 #include "catapult/consumers/TransactionConsumers.h"
 #include "catapult/consumers/UndoBlock.h"
+#include "catapult/consumers/UndoRecords.h"
+#include "catapult/crypto/PublicKeyPointCache.h"
 #include "catapult/disruptor/BatchRangeDispatcher.h"
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ExecutionConfigurationFactory.h"
@@ -160,6 +163,24 @@ namespace catapult { namespace sync {
 			};
 			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, extensions::CreateExecutionConfiguration(pluginManager));
 
+			// undo records are only used with in-memory caches because they retain copies of all changed cache entries
+			if (!state.config().Node.EnableCacheDatabaseStorage) {
+				auto pUndoRecords = std::make_shared<UndoRecords>(state.cache(), blockChainConfig.MaxRollbackBlocks);
+				syncHandlers.FastUndo = [&rollbackInfo, &cache = state.cache(), pUndoRecords](auto& cacheDelta, auto commonHeight) {
+					auto numUndoneBlocks = (cache.createView().height() - commonHeight).unwrap();
+					if (!pUndoRecords->tryUndo(cacheDelta, commonHeight))
+						return false;
+
+					for (auto i = 0u; i < numUndoneBlocks; ++i)
+						rollbackInfo.increment();
+
+					return true;
+				};
+				syncHandlers.PreCommit = [pUndoRecords](const auto& cacheDelta, auto commonHeight, auto newHeight) {
+					pUndoRecords->capture(cacheDelta, commonHeight, newHeight);
+				};
+			}
+
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
 				localScore += changeInfo.ScoreDelta;
@@ -190,10 +211,11 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHash,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pValidatorPool));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -201,6 +223,7 @@ namespace catapult { namespace sync {
 
 			std::shared_ptr<ConsumerDispatcher> build(
 					const std::shared_ptr<thread::IoThreadPool>& pValidatorPool,
+					const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 					RollbackInfo& rollbackInfo) {
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()));
 				m_consumers.push_back(CreateBlockChainCheckConsumer(
@@ -214,6 +237,7 @@ namespace catapult { namespace sync {
 						m_state.config().BlockChain.Network.GenerationHash,
 						m_state.pluginManager().createNotificationPublisher(),
 						pValidatorPool,
+						pPointCache,
 						requiresValidationPredicate));
 
 				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
@@ -272,10 +296,11 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHash,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pValidatorPool));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
@@ -284,6 +309,7 @@ namespace catapult { namespace sync {
 
 			std::shared_ptr<ConsumerDispatcher> build(
 					const std::shared_ptr<thread::IoThreadPool>& pValidatorPool,
+					const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 					chain::UtUpdater& utUpdater) {
 				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
@@ -293,6 +319,7 @@ namespace catapult { namespace sync {
 						m_state.config().BlockChain.Network.GenerationHash,
 						m_state.pluginManager().createNotificationPublisher(),
 						pValidatorPool,
+						pPointCache,
 						failedTransactionSink));
 
 				auto disruptorConsumers = DisruptorConsumersFromTransactionConsumers(m_consumers);
@@ -359,6 +386,26 @@ namespace catapult { namespace sync {
 			return utUpdater;
 		}
 
+		auto CreateAndRegisterPublicKeyPointCache(extensions::ServiceLocator& locator, const config::NodeConfiguration& config) {
+			auto pPointCache = std::make_shared<crypto::PublicKeyPointCache>(config.PublicKeyPointCacheMaxSize);
+			locator.registerRootedService("dispatcher.publicKeyPointCache", pPointCache);
+			return pPointCache;
+		}
+
+		void AddPublicKeyPointCacheCounters(extensions::ServiceLocator& locator) {
+			using crypto::PublicKeyPointCache;
+			const auto* serviceName = "dispatcher.publicKeyPointCache";
+			locator.registerServiceCounter<PublicKeyPointCache>(serviceName, "PKCACHE SIZE", [](const auto& pointCache) {
+				return pointCache.size();
+			});
+			locator.registerServiceCounter<PublicKeyPointCache>(serviceName, "PKCACHE HITS", [](const auto& pointCache) {
+				return pointCache.numHits();
+			});
+			locator.registerServiceCounter<PublicKeyPointCache>(serviceName, "PKCACHE MISS", [](const auto& pointCache) {
+				return pointCache.numMisses();
+			});
+		}
+
 		auto CreateAndRegisterRollbackService(
 				extensions::ServiceLocator& locator,
 				const chain::TimeSupplier& timeSupplier,
@@ -395,11 +442,14 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				AddPublicKeyPointCacheCounters(locator);
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto pValidatorPool = state.pool().pushIsolatedPool("validator");
+				auto pPointCache = CreateAndRegisterPublicKeyPointCache(locator, state.config().Node);
 				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
 
 				// create the block and transaction dispatchers and related services
@@ -407,17 +457,19 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().BlockChain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(pValidatorPool, *pRollbackInfo);
+				auto pBlockDispatcher = blockDispatcherBuilder.build(pValidatorPool, pPointCache, *pRollbackInfo);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
+				extensions::AddDispatcherLatencies(state.latencyHistograms(), *pBlockDispatcher, "BLK");
 
-				auto pTransactionDispatcher = transactionDispatcherBuilder.build(pValidatorPool, utUpdater);
+				auto pTransactionDispatcher = transactionDispatcherBuilder.build(pValidatorPool, pPointCache, utUpdater);
 				RegisterTransactionDispatcherService(pTransactionDispatcher, *pServiceGroup, locator, state);
+				extensions::AddDispatcherLatencies(state.latencyHistograms(), *pTransactionDispatcher, "TX");
 			}
 		};
 	}
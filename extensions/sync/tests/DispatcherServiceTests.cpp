@@ -45,8 +45,8 @@ namespace catapult { namespace sync {
 #define TEST_CLASS DispatcherServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 8u;
+		constexpr auto Num_Expected_Services = 6u;
+		constexpr auto Num_Expected_Counters = 11u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -57,6 +57,9 @@ namespace catapult { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Public_Key_Point_Cache_Size = "PKCACHE SIZE";
+		constexpr auto Public_Key_Point_Cache_Hits = "PKCACHE HITS";
+		constexpr auto Public_Key_Point_Cache_Misses = "PKCACHE MISS";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -316,6 +319,7 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.publicKeyPointCache"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should be zero
@@ -327,6 +331,9 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Size));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Hits));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Misses));
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -339,6 +346,16 @@ namespace catapult { namespace sync {
 		EXPECT_EQ("transaction dispatcher", transactionDispatcherStatus.Name);
 		EXPECT_EQ(5u, transactionDispatcherStatus.Size);
 		EXPECT_TRUE(transactionDispatcherStatus.IsRunning);
+
+		// - consumer latencies of both dispatchers should be registered
+		auto latencyEntries = context.testState().latencyHistograms().entries();
+		ASSERT_EQ(7u + 5, latencyEntries.size());
+		EXPECT_EQ("BLK ELEM LAT", latencyEntries[0].Id.name());
+		EXPECT_EQ("BLK ELEM LAT", latencyEntries[6].Id.name());
+		EXPECT_EQ(6u, latencyEntries[6].Index);
+		EXPECT_EQ("TX ELEM LAT", latencyEntries[7].Id.name());
+		EXPECT_EQ("TX ELEM LAT", latencyEntries[11].Id.name());
+		EXPECT_EQ(4u, latencyEntries[11].Index);
 	}
 
 	TEST(TEST_CLASS, CanBootServiceWithAuditingEnabled) {
@@ -398,6 +415,7 @@ namespace catapult { namespace sync {
 		EXPECT_FALSE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.publicKeyPointCache"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should indicate shutdown
@@ -409,6 +427,9 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Size));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Hits));
+		EXPECT_EQ(0u, context.counter(Public_Key_Point_Cache_Misses));
 	}
 
 	// endregion
@@ -20,7 +20,7 @@
 
 #include "Validators.h"
 #include "catapult/cache_core/AccountStateCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/state/CatapultState.h"
 #include "catapult/validators/ValidatorContext.h"
 
@@ -55,7 +55,7 @@ namespace catapult { namespace validators {
 			}
 
 			// if state could not be accessed by public key, try searching by address
-			auto accountStateAddressIter = cache.find(model::PublicKeyToAddress(publicKey, cache.networkIdentifier()));
+			auto accountStateAddressIter = cache.find(model::CachedPublicKeyToAddress(publicKey, cache.networkIdentifier()));
 			if (accountStateAddressIter.tryGet()) {
 				amount = accountStateAddressIter.get().Balances.get(mosaicId);
 				return true;
@@ -21,7 +21,7 @@
 #include "Observers.h"
 #include "src/cache/AccountRestrictionCache.h"
 #include "src/state/AccountRestrictionUtils.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 
 namespace catapult { namespace observers {
 
@@ -45,7 +45,7 @@ namespace catapult { namespace observers {
 		template<typename TNotification>
 		void ObserveNotification(const TNotification& notification, const ObserverContext& context) {
 			auto& restrictionCache = context.Cache.sub<cache::AccountRestrictionCache>();
-			auto address = model::PublicKeyToAddress(notification.Key, restrictionCache.networkIdentifier());
+			auto address = model::CachedPublicKeyToAddress(notification.Key, restrictionCache.networkIdentifier());
 
 			auto restrictionsIter = restrictionCache.find(address);
 			if (!restrictionsIter.tryGet()) {
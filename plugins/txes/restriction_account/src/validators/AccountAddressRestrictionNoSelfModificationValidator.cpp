@@ -19,7 +19,7 @@
 **/
 
 #include "Validators.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/model/ResolverContext.h"
 
 namespace catapult { namespace validators {
@@ -29,7 +29,7 @@ namespace catapult { namespace validators {
 	DECLARE_STATELESS_VALIDATOR(AccountAddressRestrictionNoSelfModification, Notification)(model::NetworkIdentifier networkIdentifier) {
 		return MAKE_STATELESS_VALIDATOR(AccountAddressRestrictionNoSelfModification, [networkIdentifier](
 				const Notification& notification) {
-			auto address = model::PublicKeyToAddress(notification.Key, networkIdentifier);
+			auto address = model::CachedPublicKeyToAddress(notification.Key, networkIdentifier);
 			return address != model::ResolverContext().resolve(notification.Modification.Value)
 					? ValidationResult::Success
 					: Failure_RestrictionAccount_Invalid_Modification_Address;
@@ -22,7 +22,7 @@
 #include "AccountRestrictionView.h"
 #include "src/cache/AccountRestrictionCache.h"
 #include "src/model/AccountOperationRestrictionTransaction.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -43,7 +43,7 @@ namespace catapult { namespace validators {
 				return !(isAllow && isRelevantEntityType);
 
 			size_t numTypedRestrictions = 0;
-			if (view.initialize(model::PublicKeyToAddress(notification.Key, context.Network.Identifier))) {
+			if (view.initialize(model::CachedPublicKeyToAddress(notification.Key, context.Network.Identifier))) {
 				auto typedRestriction = view.get<model::EntityType>(Restriction_Type);
 				numTypedRestrictions = typedRestriction.size();
 			}
@@ -20,7 +20,7 @@
 
 #include "Validators.h"
 #include "src/cache/AccountRestrictionCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -37,7 +37,7 @@ namespace catapult { namespace validators {
 
 		template<typename TRestrictionValue, typename TNotification>
 		ValidationResult Validate(const TNotification& notification, const ValidatorContext& context) {
-			auto address = model::PublicKeyToAddress(notification.Key, context.Network.Identifier);
+			auto address = model::CachedPublicKeyToAddress(notification.Key, context.Network.Identifier);
 			const auto& cache = context.Cache.sub<cache::AccountRestrictionCache>();
 			if (!cache.contains(address))
 				return ValidationResult::Success;
@@ -21,7 +21,7 @@
 #include "Validators.h"
 #include "AccountRestrictionView.h"
 #include "src/cache/AccountRestrictionCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -54,7 +54,7 @@ namespace catapult { namespace validators {
 
 	DEFINE_STATEFUL_VALIDATOR(AddressInteraction, [](const Notification& notification, const ValidatorContext& context) {
 		auto networkIdentifier = context.Network.Identifier;
-		auto sourceAddress = model::PublicKeyToAddress(notification.Source, networkIdentifier);
+		auto sourceAddress = model::CachedPublicKeyToAddress(notification.Source, networkIdentifier);
 		for (const auto& address : notification.ParticipantsByAddress) {
 			auto participant = context.Resolvers.resolve(address);
 			if (!IsInteractionAllowed(context.Cache, sourceAddress, participant))
@@ -62,7 +62,7 @@ namespace catapult { namespace validators {
 		}
 
 		for (const auto& key : notification.ParticipantsByKey) {
-			auto participant = model::PublicKeyToAddress(key, networkIdentifier);
+			auto participant = model::CachedPublicKeyToAddress(key, networkIdentifier);
 			if (!IsInteractionAllowed(context.Cache, sourceAddress, participant))
 				return Failure_RestrictionAccount_Address_Interaction_Prohibited;
 		}
@@ -20,7 +20,7 @@
 
 #include "Validators.h"
 #include "src/cache/AccountRestrictionCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -54,7 +54,7 @@ namespace catapult { namespace validators {
 			if (maxAccountRestrictionValues < notification.ModificationsCount)
 				return Failure_RestrictionAccount_Modification_Count_Exceeded;
 
-			auto address = model::PublicKeyToAddress(notification.Key, context.Network.Identifier);
+			auto address = model::CachedPublicKeyToAddress(notification.Key, context.Network.Identifier);
 			const auto* pModifications = notification.ModificationsPtr;
 			const auto& cache = context.Cache.sub<cache::AccountRestrictionCache>();
 			if (!cache.contains(address))
@@ -21,7 +21,7 @@
 #include "Validators.h"
 #include "AccountRestrictionView.h"
 #include "src/cache/AccountRestrictionCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -31,7 +31,7 @@ namespace catapult { namespace validators {
 	DEFINE_STATEFUL_VALIDATOR(OperationRestriction, [](const Notification& notification, const ValidatorContext& context) {
 		constexpr auto Restriction_Type = model::AccountRestrictionType::TransactionType | model::AccountRestrictionType::Outgoing;
 		AccountRestrictionView view(context.Cache);
-		if (!view.initialize(model::PublicKeyToAddress(notification.Signer, context.Network.Identifier)))
+		if (!view.initialize(model::CachedPublicKeyToAddress(notification.Signer, context.Network.Identifier)))
 			return ValidationResult::Success;
 
 		auto isTransferAllowed = view.isAllowed(Restriction_Type, notification.TransactionType);
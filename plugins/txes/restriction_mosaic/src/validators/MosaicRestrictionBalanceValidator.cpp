@@ -21,7 +21,7 @@
 #include "Validators.h"
 #include "src/cache/MosaicRestrictionCache.h"
 #include "src/cache/MosaicRestrictionCacheUtils.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -61,7 +61,7 @@ namespace catapult { namespace validators {
 					const auto& mosaicRules) {
 				auto isSenderAuthorized = cache::EvaluateMosaicRestrictionResolvedRulesForAddress(
 						cache,
-						model::PublicKeyToAddress(notification.Sender, cache.networkIdentifier()),
+						model::CachedPublicKeyToAddress(notification.Sender, cache.networkIdentifier()),
 						mosaicRules);
 				auto isRecipientAuthorized = cache::EvaluateMosaicRestrictionResolvedRulesForAddress(
 						cache,
@@ -75,7 +75,7 @@ namespace catapult { namespace validators {
 			return ProcessMosaicRules(notification.MosaicId, context, [&notification](const auto& cache, const auto& mosaicRules) {
 				return cache::EvaluateMosaicRestrictionResolvedRulesForAddress(
 						cache,
-						model::PublicKeyToAddress(notification.Sender, cache.networkIdentifier()),
+						model::CachedPublicKeyToAddress(notification.Sender, cache.networkIdentifier()),
 						mosaicRules);
 			});
 		}
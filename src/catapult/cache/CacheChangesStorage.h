@@ -44,5 +44,11 @@ namespace catapult { namespace cache {
 
 		/// Applies cache \a changes to the underlying cache.
 		virtual void apply(const CacheChanges& changes) const = 0;
+
+		/// Applies cache \a changes to \a cacheDelta without committing.
+		virtual void apply(const CacheChanges& changes, CatapultCacheDelta& cacheDelta) const = 0;
+
+		/// Creates cache changes that revert all pending changes in \a cacheDelta.
+		virtual std::unique_ptr<const MemoryCacheChanges> createUndoChanges(const CatapultCacheDelta& cacheDelta) const = 0;
 	};
 }}
@@ -45,22 +45,41 @@ namespace catapult { namespace cache {
 
 		void apply(const CacheChanges& changes) const override {
 			auto delta = m_cache.createDelta();
+			applyTo(changes.sub<TCache>(), *delta);
+			m_cache.commit();
+		}
+
+		void apply(const CacheChanges& changes, CatapultCacheDelta& cacheDelta) const override {
+			applyTo(changes.sub<TCache>(), cacheDelta.sub<TCache>());
+		}
+
+		std::unique_ptr<const MemoryCacheChanges> createUndoChanges(const CatapultCacheDelta& cacheDelta) const override {
+			// reverting a delta requires restoring original values of all modified and removed elements
+			// and purging all added elements
+			const auto& subCacheDelta = cacheDelta.sub<TCache>();
+			auto pMemoryCacheChanges = std::make_unique<MemoryCacheChangesT<typename TCache::CacheValueType>>();
+			pMemoryCacheChanges->Added = subCacheDelta.originalElements();
+			for (const auto* pAdded : subCacheDelta.addedElements())
+				pMemoryCacheChanges->Removed.push_back(*pAdded);
 
-			auto subCacheChanges = changes.sub<TCache>();
+			return std::move(pMemoryCacheChanges);
+		}
+
+	private:
+		template<typename TSubCacheChanges, typename TCacheDelta>
+		static void applyTo(const TSubCacheChanges& subCacheChanges, TCacheDelta& delta) {
 			for (const auto* pAdded : subCacheChanges.addedElements()) {
-				TStorageTraits::Purge(*pAdded, *delta);
-				TStorageTraits::LoadInto(*pAdded, *delta);
+				TStorageTraits::Purge(*pAdded, delta);
+				TStorageTraits::LoadInto(*pAdded, delta);
 			}
 
 			for (const auto* pModified : subCacheChanges.modifiedElements()) {
-				TStorageTraits::Purge(*pModified, *delta);
-				TStorageTraits::LoadInto(*pModified, *delta);
+				TStorageTraits::Purge(*pModified, delta);
+				TStorageTraits::LoadInto(*pModified, delta);
 			}
 
 			for (const auto* pRemoved : subCacheChanges.removedElements())
-				TStorageTraits::Purge(*pRemoved, *delta);
-
-			m_cache.commit();
+				TStorageTraits::Purge(*pRemoved, delta);
 		}
 
 	private:
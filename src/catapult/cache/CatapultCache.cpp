@@ -27,6 +27,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -259,6 +260,7 @@ namespace catapult { namespace cache {
 			, m_pDependentState(std::make_unique<state::CatapultState>())
 			, m_pDependentStateDelta(std::make_unique<state::CatapultState>())
 			, m_subCaches(std::move(subCaches))
+			, m_pCommitLatency(std::make_shared<utils::LatencyHistogram>())
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -294,6 +296,8 @@ namespace catapult { namespace cache {
 	}
 
 	void CatapultCache::commit(Height height) {
+		utils::LatencyRecorder recorder(*m_pCommitLatency);
+
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
@@ -307,6 +311,10 @@ namespace catapult { namespace cache {
 		cacheHeightModifier.set(height);
 	}
 
+	std::shared_ptr<const utils::LatencyHistogram> CatapultCache::commitLatency() const {
+		return m_pCommitLatency;
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
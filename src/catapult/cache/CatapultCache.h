@@ -32,6 +32,7 @@ namespace catapult {
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
+	namespace utils { class LatencyHistogram; }
 }
 
 namespace catapult { namespace cache {
@@ -72,6 +73,9 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+		/// Gets the commit latency histogram.
+		std::shared_ptr<const utils::LatencyHistogram> commitLatency() const;
+
 	public:
 		/// Gets cache storages for all sub caches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -87,5 +91,6 @@ namespace catapult { namespace cache {
 		std::unique_ptr<state::CatapultState> m_pDependentState; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<state::CatapultState> m_pDependentStateDelta; // backing for (single) outstanding delta
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::shared_ptr<utils::LatencyHistogram> m_pCommitLatency; // use a shared_ptr to allow fwd declare and sharing with diagnostics
 	};
 }}
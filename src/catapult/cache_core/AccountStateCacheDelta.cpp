@@ -19,7 +19,7 @@
 **/
 
 #include "AccountStateCacheDelta.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/functions.h"
@@ -82,7 +82,7 @@ namespace catapult { namespace cache {
 		if (pPair)
 			return pPair->second;
 
-		auto address = model::PublicKeyToAddress(publicKey, m_options.NetworkIdentifier);
+		auto address = model::CachedPublicKeyToAddress(publicKey, m_options.NetworkIdentifier);
 		m_pKeyToAddress->emplace(publicKey, address);
 		return address;
 	}
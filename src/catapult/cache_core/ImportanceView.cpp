@@ -20,7 +20,7 @@
 
 #include "ImportanceView.h"
 #include "AccountStateCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
 
 namespace catapult { namespace cache {
 
@@ -55,7 +55,7 @@ namespace catapult { namespace cache {
 				return ForwardIfAccountHasImportanceAtHeight(accountStateKeyIter.get(), cache, height, action);
 
 			// if state could not be accessed by public key, try searching by address
-			auto accountStateAddressIter = cache.find(model::PublicKeyToAddress(publicKey, cache.networkIdentifier()));
+			auto accountStateAddressIter = cache.find(model::CachedPublicKeyToAddress(publicKey, cache.networkIdentifier()));
 			if (accountStateAddressIter.tryGet())
 				return ForwardIfAccountHasImportanceAtHeight(accountStateAddressIter.get(), cache, height, action);
 
@@ -23,63 +23,95 @@
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/utils/Hashers.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
-	struct TransactionData : public model::TransactionInfo, public utils::NonCopyable {
-	public:
-		explicit TransactionData(size_t id)
-				: model::TransactionInfo()
-				, Id(id)
-		{}
+	namespace {
+		struct TransactionData : public model::TransactionInfo, public utils::NonCopyable {
+		public:
+			TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
+					: model::TransactionInfo(transactionInfo.copy())
+					, Id(id)
+			{}
 
-		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
-				: model::TransactionInfo(transactionInfo.copy())
-				, Id(id)
-		{}
+		public:
+			size_t Id;
+		};
 
-	public:
-		bool operator<(const TransactionData& rhs) const {
-			return Id < rhs.Id;
+		// transaction data is never modified after being added, so it can be shared by all snapshots
+		using TransactionDataPointer = std::shared_ptr<const TransactionData>;
+
+		// chunk of transaction data ordered by id
+		using TransactionDataChunk = std::vector<TransactionDataPointer>;
+
+		// map of hashes to ids
+		using IdLookupShard = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+
+		constexpr size_t Max_Chunk_Size = 256;
+		constexpr size_t Num_Id_Lookup_Shards = 256;
+
+		size_t GetIdLookupShardIndex(const Hash256& hash) {
+			// use a byte not consumed by ArrayHasher so that shard selection is independent of bucket selection
+			return hash[0];
+		}
+
+		bool IdLessThanChunk(size_t id, const std::shared_ptr<TransactionDataChunk>& pChunk) {
+			return id < pChunk->front()->Id;
 		}
 
+		bool DataIdLessThanId(const TransactionDataPointer& pData, size_t id) {
+			return pData->Id < id;
+		}
+	}
+
+	struct MemoryUtCacheSnapshot {
+	public:
+		MemoryUtCacheSnapshot() : Size(0)
+		{}
+
 	public:
-		size_t Id;
+		size_t Size;
+		std::vector<std::shared_ptr<const TransactionDataChunk>> Chunks;
+		std::array<std::shared_ptr<const IdLookupShard>, Num_Id_Lookup_Shards> IdLookupShards;
 	};
 
 	// region MemoryUtCacheView
 
-	MemoryUtCacheView::MemoryUtCacheView(
-			uint64_t maxResponseSize,
-			const TransactionDataContainer& transactionDataContainer,
-			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+	MemoryUtCacheView::MemoryUtCacheView(uint64_t maxResponseSize, const std::shared_ptr<const MemoryUtCacheSnapshot>& pSnapshot)
 			: m_maxResponseSize(maxResponseSize)
-			, m_transactionDataContainer(transactionDataContainer)
-			, m_idLookup(idLookup)
-			, m_readLock(std::move(readLock))
+			, m_pSnapshot(pSnapshot)
 	{}
 
 	size_t MemoryUtCacheView::size() const {
-		return m_transactionDataContainer.size();
+		return m_pSnapshot->Size;
 	}
 
 	bool MemoryUtCacheView::contains(const Hash256& hash) const {
-		return m_idLookup.cend() != m_idLookup.find(hash);
+		const auto& idLookupShard = *m_pSnapshot->IdLookupShards[GetIdLookupShardIndex(hash)];
+		return idLookupShard.cend() != idLookupShard.find(hash);
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
+		for (const auto& pChunk : m_pSnapshot->Chunks) {
+			for (const auto& pData : *pChunk) {
+				if (!consumer(*pData))
+					return;
+			}
 		}
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
-		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
+		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_pSnapshot->Size);
 		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
+		forEach([&shortHashesIter](const auto& transactionInfo) {
+			*shortHashesIter++ = utils::ToShortHash(transactionInfo.EntityHash);
+			return true;
+		});
 
 		return shortHashes;
 	}
@@ -89,116 +121,214 @@ namespace catapult { namespace cache {
 			const utils::ShortHashesSet& knownShortHashes) const {
 		uint64_t totalSize = 0;
 		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
+		forEach([maxResponseSize = m_maxResponseSize, minFeeMultiplier, &knownShortHashes, &totalSize, &transactions](
+				const auto& transactionInfo) {
+			if (transactionInfo.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *transactionInfo.pEntity))
+				return true;
 
-			auto shortHash = utils::ToShortHash(data.EntityHash);
+			auto shortHash = utils::ToShortHash(transactionInfo.EntityHash);
 			auto iter = knownShortHashes.find(shortHash);
 			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
+				auto pTransaction = transactionInfo.pEntity;
 				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
+				if (totalSize > maxResponseSize)
+					return false;
 
 				transactions.push_back(pTransaction);
 			}
-		}
+
+			return true;
+		});
 
 		return transactions;
 	}
 
 	// endregion
 
+	// region TransactionDataStore
+
+	namespace {
+		// mutable transaction data that shares unmodified chunks and id lookup shards with the last published snapshot
+		class TransactionDataStore {
+		public:
+			TransactionDataStore() : Size(0), IsDirty(true) {
+				for (auto& pIdLookupShard : IdLookupShards)
+					pIdLookupShard = std::make_shared<IdLookupShard>();
+			}
+
+		public:
+			const IdLookupShard& idLookupShard(const Hash256& hash) const {
+				return *IdLookupShards[GetIdLookupShardIndex(hash)];
+			}
+
+			void add(const model::TransactionInfo& transactionInfo, size_t id) {
+				auto pData = std::make_shared<const TransactionData>(transactionInfo, id);
+
+				// ids are strictly increasing, so new data is always appended to the last chunk
+				if (Chunks.empty() || Max_Chunk_Size <= Chunks.back()->size())
+					Chunks.push_back(std::make_shared<TransactionDataChunk>());
+
+				mutableCopy(Chunks.back()).push_back(pData);
+				mutableCopy(IdLookupShards[GetIdLookupShardIndex(transactionInfo.EntityHash)]).emplace(transactionInfo.EntityHash, id);
+				++Size;
+				IsDirty = true;
+			}
+
+			TransactionDataPointer remove(const Hash256& hash, size_t id) {
+				auto chunkIter = std::upper_bound(Chunks.begin(), Chunks.end(), id, IdLessThanChunk);
+				auto& pChunk = *--chunkIter;
+				auto dataIter = std::lower_bound(pChunk->cbegin(), pChunk->cend(), id, DataIdLessThanId);
+				auto dataIndex = static_cast<size_t>(dataIter - pChunk->cbegin());
+				auto pData = *dataIter;
+
+				if (1 == pChunk->size()) {
+					Chunks.erase(chunkIter);
+				} else {
+					auto& chunk = mutableCopy(pChunk);
+					chunk.erase(chunk.begin() + static_cast<std::ptrdiff_t>(dataIndex));
+				}
+
+				mutableCopy(IdLookupShards[GetIdLookupShardIndex(hash)]).erase(hash);
+				--Size;
+				IsDirty = true;
+				return pData;
+			}
+
+			template<typename TConsumer>
+			void forEach(TConsumer consumer) const {
+				for (const auto& pChunk : Chunks) {
+					for (const auto& pData : *pChunk)
+						consumer(*pData);
+				}
+			}
+
+			void clear() {
+				Chunks.clear();
+				for (auto& pIdLookupShard : IdLookupShards)
+					pIdLookupShard = std::make_shared<IdLookupShard>();
+
+				Size = 0;
+				IsDirty = true;
+			}
+
+			std::shared_ptr<const MemoryUtCacheSnapshot> createSnapshot() {
+				auto pSnapshot = std::make_shared<MemoryUtCacheSnapshot>();
+				pSnapshot->Size = Size;
+				pSnapshot->Chunks.assign(Chunks.cbegin(), Chunks.cend());
+				std::copy(IdLookupShards.cbegin(), IdLookupShards.cend(), pSnapshot->IdLookupShards.begin());
+				IsDirty = false;
+				return pSnapshot;
+			}
+
+		private:
+			template<typename T>
+			static T& mutableCopy(std::shared_ptr<T>& pValue) {
+				// copy value when it is shared with a published snapshot
+				if (1 != pValue.use_count())
+					pValue = std::make_shared<T>(*pValue);
+
+				// synchronize with the release of the last snapshot that referenced the value
+				std::atomic_thread_fence(std::memory_order_acquire);
+				return *pValue;
+			}
+
+		public:
+			size_t Size;
+			bool IsDirty;
+			std::vector<std::shared_ptr<TransactionDataChunk>> Chunks;
+			std::array<std::shared_ptr<IdLookupShard>, Num_Id_Lookup_Shards> IdLookupShards;
+			AccountCounters Counters;
+		};
+	}
+
+	// endregion
+
 	// region MemoryUtCacheModifier
 
 	namespace {
 		class MemoryUtCacheModifier : public UtCacheModifier {
 		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+			using PublishSnapshot = consumer<const std::shared_ptr<const MemoryUtCacheSnapshot>&>;
 
 		public:
 			MemoryUtCacheModifier(
 					uint64_t maxCacheSize,
 					size_t& idSequence,
-					TransactionDataContainer& transactionDataContainer,
-					IdLookup& idLookup,
-					AccountCounters& counters,
-					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+					TransactionDataStore& store,
+					const PublishSnapshot& publishSnapshot,
+					std::unique_lock<std::mutex>&& modifierLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
-					, m_transactionDataContainer(transactionDataContainer)
-					, m_idLookup(idLookup)
-					, m_counters(counters)
-					, m_readLock(std::move(readLock))
-					, m_writeLock(m_readLock.promoteToWriter())
+					, m_store(store)
+					, m_publishSnapshot(publishSnapshot)
+					, m_modifierLock(std::move(modifierLock))
 			{}
 
+			~MemoryUtCacheModifier() override {
+				if (m_store.IsDirty)
+					m_publishSnapshot(m_store.createSnapshot());
+			}
+
 		public:
 			size_t size() const override {
-				return m_transactionDataContainer.size();
+				return m_store.Size;
 			}
 
 			bool add(const model::TransactionInfo& transactionInfo) override {
-				if (m_maxCacheSize <= m_transactionDataContainer.size())
+				if (m_maxCacheSize <= m_store.Size)
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				const auto& idLookupShard = m_store.idLookupShard(transactionInfo.EntityHash);
+				if (idLookupShard.cend() != idLookupShard.find(transactionInfo.EntityHash))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				m_store.add(transactionInfo, ++m_idSequence);
 
-				m_counters.increment(transactionInfo.pEntity->SignerPublicKey);
+				m_store.Counters.increment(transactionInfo.pEntity->SignerPublicKey);
 
-				LogSizes("unconfirmed transactions", m_transactionDataContainer.size(), m_maxCacheSize);
+				LogSizes("unconfirmed transactions", m_store.Size, m_maxCacheSize);
 				return true;
 			}
 
 			model::TransactionInfo remove(const Hash256& hash) override {
-				auto iter = m_idLookup.find(hash);
-				if (m_idLookup.cend() == iter)
+				const auto& idLookupShard = m_store.idLookupShard(hash);
+				auto iter = idLookupShard.find(hash);
+				if (idLookupShard.cend() == iter)
 					return model::TransactionInfo();
 
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
-				auto erasedInfo = dataIter->copy();
-
-				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
+				auto pData = m_store.remove(hash, iter->second);
 
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
-				return erasedInfo;
+				m_store.Counters.decrement(pData->pEntity->SignerPublicKey);
+				return pData->copy();
 			}
 
 			size_t count(const Key& key) const override {
-				return m_counters.count(key);
+				return m_store.Counters.count(key);
 			}
 
 			std::vector<model::TransactionInfo> removeAll() override {
-				if (!m_transactionDataContainer.empty())
-					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
+				if (0 != m_store.Size)
+					CATAPULT_LOG(debug) << "removing " << m_store.Size << " elements from ut cache";
 
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
+				// unfortunately cannot just move transaction data because it contains a different (derived) type
 				std::vector<model::TransactionInfo> transactionInfosCopy;
-				transactionInfosCopy.reserve(m_transactionDataContainer.size());
+				transactionInfosCopy.reserve(m_store.Size);
 
-				for (const auto& data : m_transactionDataContainer)
+				m_store.forEach([&transactionInfosCopy](const auto& data) {
 					transactionInfosCopy.emplace_back(data.copy());
+				});
 
-				m_transactionDataContainer.clear();
-				m_idLookup.clear();
-				m_counters.reset();
+				m_store.clear();
+				m_store.Counters.reset();
 				return transactionInfosCopy;
 			}
 
 		private:
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
-			TransactionDataContainer& m_transactionDataContainer;
-			IdLookup& m_idLookup;
-			AccountCounters& m_counters;
-			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			TransactionDataStore& m_store;
+			PublishSnapshot m_publishSnapshot;
+			std::unique_lock<std::mutex> m_modifierLock;
 		};
 	}
 
@@ -206,34 +336,33 @@ namespace catapult { namespace cache {
 
 	// region MemoryUtCache
 
-	struct MemoryUtCache::Impl {
-		cache::TransactionDataContainer TransactionDataContainer;
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
-		AccountCounters Counters;
-	};
+	struct MemoryUtCache::Impl : public TransactionDataStore {};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
 			: m_options(options)
 			, m_idSequence(0)
 			, m_pImpl(std::make_unique<Impl>())
+			, m_pSnapshot(m_pImpl->createSnapshot())
 	{}
 
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, std::move(readLock));
+		utils::SpinLockGuard guard(m_snapshotLock);
+		return MemoryUtCacheView(m_options.MaxResponseSize, m_pSnapshot);
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
-		auto readLock = m_lock.acquireReader();
+		std::unique_lock<std::mutex> modifierLock(m_modifierMutex);
 		return UtCacheModifierProxy(std::make_unique<MemoryUtCacheModifier>(
 				m_options.MaxCacheSize,
 				m_idSequence,
-				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
-				m_pImpl->Counters,
-				std::move(readLock)));
+				*m_pImpl,
+				[this](const auto& pSnapshot) {
+					utils::SpinLockGuard guard(m_snapshotLock);
+					m_pSnapshot = pSnapshot;
+				},
+				std::move(modifierLock)));
 	}
 
 	// endregion
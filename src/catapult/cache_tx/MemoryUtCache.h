@@ -22,35 +22,26 @@
 #include "MemoryCacheOptions.h"
 #include "MemoryCacheProxy.h"
 #include "UtCache.h"
+#include "catapult/functions.h"
 #include "catapult/model/RangeTypes.h"
-#include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
-#include <set>
-#include <unordered_map>
+#include "catapult/utils/ShortHash.h"
+#include "catapult/utils/SpinLock.h"
+#include <mutex>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult { namespace cache { struct MemoryUtCacheSnapshot; } }
 
 namespace catapult { namespace cache {
 
-	/// Internal container wrapped by MemoryUtCache.
-	/// \note std::set is used to allow incomplete type.
-	using TransactionDataContainer = std::set<TransactionData>;
-
 	/// A read only view on top of unconfirmed transactions cache.
+	/// \note The view is backed by an immutable snapshot of the cache, so it neither blocks nor is blocked by modifiers.
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
-		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
-		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
-		MemoryUtCacheView(
-				uint64_t maxResponseSize,
-				const TransactionDataContainer& transactionDataContainer,
-				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around a maximum response size (\a maxResponseSize) and a cache snapshot (\a pSnapshot).
+		MemoryUtCacheView(uint64_t maxResponseSize, const std::shared_ptr<const MemoryUtCacheSnapshot>& pSnapshot);
 
 	public:
 		/// Returns the number of unconfirmed transactions in the cache.
@@ -72,12 +63,12 @@ namespace catapult { namespace cache {
 
 	private:
 		uint64_t m_maxResponseSize;
-		const TransactionDataContainer& m_transactionDataContainer;
-		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		std::shared_ptr<const MemoryUtCacheSnapshot> m_pSnapshot;
 	};
 
 	/// Cache for all unconfirmed transactions.
+	/// \note Modifiers are serialized and publish a new snapshot upon destruction.
+	///        Unmodified parts of the previous snapshot are shared with the new one.
 	class MemoryUtCache : public UtCache {
 	public:
 		/// Creates an unconfirmed transactions cache around \a options.
@@ -100,7 +91,9 @@ namespace catapult { namespace cache {
 		MemoryCacheOptions m_options;
 		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		std::mutex m_modifierMutex;
+		mutable utils::SpinLock m_snapshotLock;
+		std::shared_ptr<const MemoryUtCacheSnapshot> m_pSnapshot;
 	};
 
 	/// A delegating proxy around a MemoryUtCache.
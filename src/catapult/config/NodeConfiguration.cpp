@@ -78,6 +78,7 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
+		LOAD_NODE_PROPERTY(PublicKeyPointCacheMaxSize);
 
 		LOAD_NODE_PROPERTY(TrustedHosts);
 
@@ -111,7 +112,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_IN_CONNECTIONS_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 34 + 4 + 4 + 5);
+		utils::VerifyBagSizeLte(bag, 35 + 4 + 4 + 5);
 		return config;
 	}
 
@@ -134,6 +134,9 @@ namespace catapult { namespace config {
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
+		/// Maximum number of decompressed public keys to cache for signature verification.
+		uint32_t PublicKeyPointCacheMaxSize;
+
 		/// Trusted hosts that are allowed to execute protected API calls on this node.
 		std::unordered_set<std::string> TrustedHosts;
 
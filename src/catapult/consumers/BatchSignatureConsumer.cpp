@@ -22,6 +22,7 @@
 #include "ConsumerResults.h"
 #include "TransactionConsumers.h"
 #include "ValidationConsumerUtils.h"
+#include "catapult/crypto/PublicKeyPointCache.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/thread/IoThreadPool.h"
@@ -97,15 +98,17 @@ namespace catapult { namespace consumers {
 			const GenerationHash& generationHash,
 			const std::shared_ptr<model::NotificationPublisher>& pPublisher,
 			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 			const RequiresValidationPredicate& requiresValidationPredicate) {
-		return MakeBlockValidationConsumer(requiresValidationPredicate, [generationHash, pPublisher, pPool](const auto& entityInfos) {
+		return MakeBlockValidationConsumer(requiresValidationPredicate, [generationHash, pPublisher, pPool, pPointCache](
+				const auto& entityInfos) {
 			// find all signature notifications
 			auto inputs = ExtractAllSignatureNotifications(generationHash, *pPublisher, entityInfos)->inputs();
 
 			// process signatures in batches
 			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
-			auto partitionCallback = [&aggregateResult](auto itBegin, auto itEnd, auto, auto) {
-				if (!VerifyMultiShortCircuit(&*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd))))
+			auto partitionCallback = [&aggregateResult, &pointCache = *pPointCache](auto itBegin, auto itEnd, auto, auto) {
+				if (!VerifyMultiShortCircuit(&*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd)), pointCache))
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
@@ -118,15 +121,17 @@ namespace catapult { namespace consumers {
 			const GenerationHash& generationHash,
 			const std::shared_ptr<model::NotificationPublisher>& pPublisher,
 			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 			const chain::FailedTransactionSink& failedTransactionSink) {
-		return MakeTransactionValidationConsumer(failedTransactionSink, [generationHash, pPublisher, pPool](const auto& entityInfos) {
+		return MakeTransactionValidationConsumer(failedTransactionSink, [generationHash, pPublisher, pPool, pPointCache](
+				const auto& entityInfos) {
 			// find all signature notifications
 			auto pSub = ExtractAllSignatureNotifications(generationHash, *pPublisher, entityInfos);
 
 			// process signatures in batches
 			std::vector<validators::ValidationResult> results(entityInfos.size(), validators::ValidationResult::Success);
-			auto partitionCallback = [&pSub, &results](auto itBegin, auto itEnd, auto startIndex, auto) {
-				auto partitionResultsPair = VerifyMulti(&*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd)));
+			auto partitionCallback = [&pSub, &results, &pointCache = *pPointCache](auto itBegin, auto itEnd, auto startIndex, auto) {
+				auto partitionResultsPair = VerifyMulti(&*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd)), pointCache);
 				if (partitionResultsPair.second)
 					return;
 
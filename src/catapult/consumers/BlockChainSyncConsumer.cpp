@@ -205,6 +205,9 @@ namespace catapult { namespace consumers {
 				if (localChainHeight == commonBlockHeight)
 					return result;
 
+				// when all changes can be reverted at once, blocks only need to be loaded to calculate the score
+				auto isUndone = m_handlers.FastUndo && m_handlers.FastUndo(observerState.Cache, commonBlockHeight);
+
 				auto height = localChainHeight;
 				std::shared_ptr<const model::BlockElement> pChildBlockElement;
 				while (true) {
@@ -221,7 +224,9 @@ namespace catapult { namespace consumers {
 						break;
 					}
 
-					m_handlers.UndoBlock(*pParentBlockElement, observerState, UndoBlockType::Rollback);
+					if (!isUndone)
+						m_handlers.UndoBlock(*pParentBlockElement, observerState, UndoBlockType::Rollback);
+
 					pChildBlockElement = std::move(pParentBlockElement);
 					height = height - Height(1);
 				}
@@ -260,6 +265,9 @@ namespace catapult { namespace consumers {
 				// - broker process is not yet able to consume changes (all changes are consumable after step 3)
 
 				// 3. commit changes to the in-memory cache and primary block chain storage
+				if (m_handlers.PreCommit)
+					m_handlers.PreCommit(syncState.cacheDelta(), syncState.commonBlockHeight(), newHeight);
+
 				syncState.commit(newHeight);
 				storageModifier.commit();
 				m_handlers.CommitStep(CommitOperationStep::All_Updated);
@@ -80,12 +80,19 @@ namespace catapult { namespace consumers {
 		/// \note This is called with all rolled back blocks and the (new) common block.
 		using UndoBlockFunc = consumer<const model::BlockElement&, observers::ObserverState&, UndoBlockType>;
 
+		/// Prototype for undoing all blocks after a common block height without observer execution.
+		/// \note This returns \c true if all changes were reverted, \c false if blocks need to be undone individually.
+		using FastUndoFunc = predicate<cache::CatapultCacheDelta&, Height>;
+
 		/// Prototype for state change notification.
 		using StateChangeFunc = consumer<const subscribers::StateChangeInfo&>;
 
 		/// Prototype for pre state written notification.
 		using PreStateWrittenFunc = consumer<const cache::CatapultCacheDelta&, Height>;
 
+		/// Prototype for pre commit notification.
+		using PreCommitFunc = consumer<const cache::CatapultCacheDelta&, Height, Height>;
+
 		/// Prototype for transaction change notification.
 		using TransactionsChangeFunc = consumer<const TransactionsChangeInfo&>;
 
@@ -102,12 +109,19 @@ namespace catapult { namespace consumers {
 		/// Undoes a block and updates a cache.
 		UndoBlockFunc UndoBlock;
 
+		/// Optionally undoes all rolled back blocks at once given a common block height.
+		/// \note When this succeeds, UndoBlock is only called with the (new) common block.
+		FastUndoFunc FastUndo;
+
 		/// Called with state change info to indicate a state change.
 		StateChangeFunc StateChange;
 
 		/// Called after state change but before state written checkpoint.
 		PreStateWrittenFunc PreStateWritten;
 
+		/// Optionally called with the common block height and the new chain height before changes are committed.
+		PreCommitFunc PreCommit;
+
 		/// Called with the hashes of confirmed transactions and the infos of reverted transactions when transaction statuses change.
 		TransactionsChangeFunc TransactionsChange;
 
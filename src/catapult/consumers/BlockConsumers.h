@@ -29,6 +29,7 @@
 
 namespace catapult {
 	namespace chain { struct CatapultState; }
+	namespace crypto { class PublicKeyPointCache; }
 	namespace io { class BlockStorageCache; }
 	namespace model { class TransactionRegistry; }
 	namespace utils { class TimeSpan; }
@@ -38,9 +39,11 @@ namespace catapult { namespace consumers {
 
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
 	/// generation hash (\a generationHash).
+	/// Transaction hashes are calculated in parallel using \a pPool.
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHash& generationHash,
-			const model::TransactionRegistry& transactionRegistry);
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
 
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
@@ -65,11 +68,13 @@ namespace catapult { namespace consumers {
 
 	/// Creates a consumer that runs batch signature validation using \a pPublisher and \a pPool for the network with the specified
 	/// generation hash (\a generationHash).
+	/// Decompressed signer public keys are cached in \a pPointCache.
 	/// Validation will only be performed for entities for which \a requiresValidationPredicate returns \c true.
 	disruptor::ConstBlockConsumer CreateBlockBatchSignatureConsumer(
 			const GenerationHash& generationHash,
 			const std::shared_ptr<model::NotificationPublisher>& pPublisher,
 			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 			const RequiresValidationPredicate& requiresValidationPredicate);
 
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
@@ -24,15 +24,36 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		template<typename TTransactionElements, typename TAccessor>
+		void UpdateAllHashes(
+				const model::TransactionRegistry& transactionRegistry,
+				const GenerationHash& generationHash,
+				thread::IoThreadPool& pool,
+				TTransactionElements& transactionElements,
+				TAccessor accessor) {
+			auto partitionCallback = [&transactionRegistry, &generationHash, accessor](auto itBegin, auto itEnd, auto, auto) {
+				for (auto iter = itBegin; itEnd != iter; ++iter)
+					model::UpdateHashes(transactionRegistry, generationHash, accessor(*iter));
+			};
+
+			thread::ParallelForPartition(pool.ioContext(), transactionElements, pool.numWorkerThreads(), partitionCallback).get();
+		}
+
 		class BlockHashCalculatorConsumer {
 		public:
-			BlockHashCalculatorConsumer(const GenerationHash& generationHash, const model::TransactionRegistry& transactionRegistry)
+			BlockHashCalculatorConsumer(
+					const GenerationHash& generationHash,
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_generationHash(generationHash)
 					, m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -40,47 +61,69 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
+				std::vector<model::TransactionElement*> transactionElements;
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHash, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.emplace_back(transaction);
+
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
+
+				// calculate the hashes of all transactions in all blocks at once in order to balance work across the pool
+				UpdateAllHashes(m_transactionRegistry, m_generationHash, *m_pPool, transactionElements, [](auto* pTransactionElement)
+						-> model::TransactionElement& {
+					return *pTransactionElement;
+				});
 
+				std::atomic_bool hasTransactionsHashMismatch(false);
+				thread::ParallelFor(m_pPool->ioContext(), elements, m_pPool->numWorkerThreads(), [&hasTransactionsHashMismatch](
+						auto& element,
+						auto) {
+					crypto::MerkleHashBuilder transactionsHashBuilder;
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
-					if (element.Block.TransactionsHash != transactionsHash)
-						return Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch);
+					if (element.Block.TransactionsHash != transactionsHash) {
+						hasTransactionsHashMismatch = true;
+						return false;
+					}
 
 					element.EntityHash = model::CalculateHash(element.Block);
-				}
+					return true;
+				}).get();
 
-				return Continue();
+				return hasTransactionsHashMismatch ? Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch) : Continue();
 			}
 
 		private:
 			GenerationHash m_generationHash;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHash& generationHash,
-			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHash, transactionRegistry);
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return BlockHashCalculatorConsumer(generationHash, transactionRegistry, pPool);
 	}
 
 	namespace {
 		class TransactionHashCalculatorConsumer {
 		public:
-			TransactionHashCalculatorConsumer(const GenerationHash& generationHash, const model::TransactionRegistry& transactionRegistry)
+			TransactionHashCalculatorConsumer(
+					const GenerationHash& generationHash,
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_generationHash(generationHash)
 					, m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -88,8 +131,10 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHash, element);
+				UpdateAllHashes(m_transactionRegistry, m_generationHash, *m_pPool, elements, [](auto& element)
+						-> model::TransactionElement& {
+					return element;
+				});
 
 				return Continue();
 			}
@@ -97,12 +142,14 @@ namespace catapult { namespace consumers {
 		private:
 			GenerationHash m_generationHash;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
 			const GenerationHash& generationHash,
-			const model::TransactionRegistry& transactionRegistry) {
-		return TransactionHashCalculatorConsumer(generationHash, transactionRegistry);
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return TransactionHashCalculatorConsumer(generationHash, transactionRegistry, pPool);
 	}
 }}
@@ -26,15 +26,20 @@
 #include "catapult/model/EntityInfo.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
-namespace catapult { namespace model { class NotificationPublisher; } }
+namespace catapult {
+	namespace crypto { class PublicKeyPointCache; }
+	namespace model { class NotificationPublisher; }
+}
 
 namespace catapult { namespace consumers {
 
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
 	/// generation hash (\a generationHash).
+	/// Transaction hashes are calculated in parallel using \a pPool.
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
 			const GenerationHash& generationHash,
-			const model::TransactionRegistry& transactionRegistry);
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
 
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
@@ -51,10 +56,12 @@ namespace catapult { namespace consumers {
 
 	/// Creates a consumer that runs batch signature validation using \a pPublisher and \a pPool for the network with the specified
 	/// generation hash (\a generationHash) and calls \a failedTransactionSink for each failure.
+	/// Decompressed signer public keys are cached in \a pPointCache.
 	disruptor::TransactionConsumer CreateTransactionBatchSignatureConsumer(
 			const GenerationHash& generationHash,
 			const std::shared_ptr<model::NotificationPublisher>& pPublisher,
 			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::PublicKeyPointCache>& pPointCache,
 			const chain::FailedTransactionSink& failedTransactionSink);
 
 	/// Prototype for a function that is called with new transactions.
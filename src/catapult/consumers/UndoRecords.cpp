@@ -0,0 +1,90 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "UndoRecords.h"
+#include "catapult/cache/CacheChangesStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/utils/Logging.h"
+
+namespace catapult { namespace consumers {
+
+	UndoRecords::UndoRecords(const cache::CatapultCache& cache, uint32_t maxRollbackBlocks)
+			: m_cache(cache)
+			, m_maxRollbackBlocks(maxRollbackBlocks)
+	{}
+
+	size_t UndoRecords::size() const {
+		return m_records.size();
+	}
+
+	void UndoRecords::capture(const cache::CatapultCacheDelta& cacheDelta, Height commonHeight, Height newHeight) {
+		auto height = committedHeight();
+		if (commonHeight != height || (!m_records.empty() && m_records.back().ChainHeight != height)) {
+			// a delta that includes a rollback contains changes relative to the rolled back chain, so it cannot be used to undo
+			// the new chain part; since all newer records have been invalidated too, start over
+			CATAPULT_LOG(debug) << "clearing " << m_records.size() << " undo records after change at height " << commonHeight;
+			m_records.clear();
+			if (commonHeight != height)
+				return;
+		}
+
+		cache::CacheChanges::MemoryCacheChangesContainer undoChangesContainer;
+		for (const auto& pStorage : m_cache.changesStorages())
+			undoChangesContainer.push_back(pStorage->createUndoChanges(cacheDelta));
+
+		auto cacheView = m_cache.createView();
+		m_records.emplace_back(commonHeight, newHeight, cacheView.dependentState(), cache::CacheChanges(std::move(undoChangesContainer)));
+		prune(newHeight);
+	}
+
+	bool UndoRecords::tryUndo(cache::CatapultCacheDelta& cacheDelta, Height commonHeight) const {
+		if (m_records.empty() || m_records.back().ChainHeight != committedHeight())
+			return false;
+
+		// find the oldest record that needs to be applied, which must start exactly at the common height
+		auto iter = m_records.crbegin();
+		for (; m_records.crend() != iter && iter->CommonHeight > commonHeight; ++iter);
+
+		if (m_records.crend() == iter || iter->CommonHeight != commonHeight)
+			return false;
+
+		// each record contains absolute original values, so applying records from newest to oldest reverts all changes
+		auto changesStorages = m_cache.changesStorages();
+		for (auto applyIter = m_records.crbegin(); iter + 1 != applyIter; ++applyIter) {
+			CATAPULT_LOG(debug) << "undoing cache changes in range (" << applyIter->CommonHeight << ", " << applyIter->ChainHeight << "]";
+			for (const auto& pStorage : changesStorages)
+				pStorage->apply(applyIter->Changes, cacheDelta);
+		}
+
+		cacheDelta.dependentState() = iter->DependentState;
+		return true;
+	}
+
+	Height UndoRecords::committedHeight() const {
+		return m_cache.createView().height();
+	}
+
+	void UndoRecords::prune(Height height) {
+		// records starting below the oldest height that can be rolled back to can never be used
+		auto minCommonHeight = Height(height.unwrap() > m_maxRollbackBlocks ? height.unwrap() - m_maxRollbackBlocks : 0);
+		while (!m_records.empty() && m_records.front().CommonHeight < minCommonHeight)
+			m_records.pop_front();
+	}
+}}
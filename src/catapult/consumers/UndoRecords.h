@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/cache/CacheChanges.h"
+#include "catapult/state/CatapultState.h"
+#include "catapult/types.h"
+#include <deque>
+
+namespace catapult { namespace cache { class CatapultCache; } }
+
+namespace catapult { namespace consumers {
+
+	/// Undo records for recently committed block ranges that allow cache rollbacks without observer execution.
+	/// \note This class is not thread safe and is expected to be used only by the block chain sync consumer.
+	class UndoRecords {
+	public:
+		/// Creates undo records around \a cache that cover at most \a maxRollbackBlocks blocks.
+		UndoRecords(const cache::CatapultCache& cache, uint32_t maxRollbackBlocks);
+
+	public:
+		/// Gets the number of undo records.
+		size_t size() const;
+
+	public:
+		/// Captures undo information for the pending changes in \a cacheDelta that change the chain from
+		/// \a commonHeight to \a newHeight.
+		/// \note This must be called before \a cacheDelta is committed.
+		void capture(const cache::CatapultCacheDelta& cacheDelta, Height commonHeight, Height newHeight);
+
+		/// Tries to revert \a cacheDelta from the committed height to \a commonHeight.
+		/// Returns \c true if all changes were reverted, \c false if the records do not cover the requested range.
+		/// \note Records are not consumed because the rollback can still be abandoned.
+		bool tryUndo(cache::CatapultCacheDelta& cacheDelta, Height commonHeight) const;
+
+	private:
+		struct UndoRecord {
+		public:
+			UndoRecord(Height commonHeight, Height height, const state::CatapultState& dependentState, cache::CacheChanges&& changes)
+					: CommonHeight(commonHeight)
+					, ChainHeight(height)
+					, DependentState(dependentState)
+					, Changes(std::move(changes))
+			{}
+
+		public:
+			Height CommonHeight;
+			Height ChainHeight;
+			state::CatapultState DependentState;
+			cache::CacheChanges Changes;
+		};
+
+	private:
+		Height committedHeight() const;
+
+		void prune(Height height);
+
+	private:
+		const cache::CatapultCache& m_cache;
+		uint32_t m_maxRollbackBlocks;
+		std::deque<UndoRecord> m_records;
+	};
+}}
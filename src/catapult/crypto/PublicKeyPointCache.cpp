@@ -0,0 +1,122 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PublicKeyPointCache.h"
+#include "catapult/utils/Hashers.h"
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr size_t Num_Shards = 16;
+
+		size_t CalculateMaxShardSize(size_t maxSize, size_t shardIndex) {
+			// distribute remainder across first shards so that sum of all shard sizes is exactly maxSize
+			return maxSize / Num_Shards + (shardIndex < maxSize % Num_Shards ? 1 : 0);
+		}
+	}
+
+	struct PublicKeyPointCache::Shard {
+	public:
+		using Entry = std::pair<Key, DecompressedPublicKey>;
+		using EntryList = std::list<Entry>;
+
+	public:
+		size_t MaxSize;
+		mutable std::mutex Mutex;
+		EntryList Entries; // ordered from most recently used to least recently used
+		std::unordered_map<Key, EntryList::iterator, utils::ArrayHasher<Key>> EntryMap;
+	};
+
+	PublicKeyPointCache::PublicKeyPointCache(size_t maxSize)
+			: m_maxSize(maxSize)
+			, m_pShards(std::make_unique<Shard[]>(Num_Shards))
+			, m_numHits(0)
+			, m_numMisses(0) {
+		for (auto i = 0u; i < Num_Shards; ++i)
+			m_pShards[i].MaxSize = CalculateMaxShardSize(maxSize, i);
+	}
+
+	PublicKeyPointCache::~PublicKeyPointCache() = default;
+
+	size_t PublicKeyPointCache::size() const {
+		size_t size = 0;
+		for (auto i = 0u; i < Num_Shards; ++i) {
+			std::lock_guard<std::mutex> guard(m_pShards[i].Mutex);
+			size += m_pShards[i].EntryMap.size();
+		}
+
+		return size;
+	}
+
+	uint64_t PublicKeyPointCache::numHits() const {
+		return m_numHits;
+	}
+
+	uint64_t PublicKeyPointCache::numMisses() const {
+		return m_numMisses;
+	}
+
+	bool PublicKeyPointCache::tryFind(const Key& publicKey, DecompressedPublicKey& point) {
+		if (0 == m_maxSize)
+			return false;
+
+		auto& shard = this->shard(publicKey);
+		{
+			std::lock_guard<std::mutex> guard(shard.Mutex);
+			auto iter = shard.EntryMap.find(publicKey);
+			if (shard.EntryMap.cend() != iter) {
+				shard.Entries.splice(shard.Entries.begin(), shard.Entries, iter->second);
+				std::memcpy(&point, &iter->second->second, sizeof(DecompressedPublicKey));
+				++m_numHits;
+				return true;
+			}
+		}
+
+		++m_numMisses;
+		return false;
+	}
+
+	void PublicKeyPointCache::insert(const Key& publicKey, const DecompressedPublicKey& point) {
+		auto& shard = this->shard(publicKey);
+		if (0 == shard.MaxSize)
+			return;
+
+		std::lock_guard<std::mutex> guard(shard.Mutex);
+		if (shard.EntryMap.cend() != shard.EntryMap.find(publicKey))
+			return;
+
+		if (shard.EntryMap.size() >= shard.MaxSize) {
+			shard.EntryMap.erase(shard.Entries.back().first);
+			shard.Entries.pop_back();
+		}
+
+		shard.Entries.emplace_front(publicKey, point);
+		shard.EntryMap.emplace(publicKey, shard.Entries.begin());
+	}
+
+	PublicKeyPointCache::Shard& PublicKeyPointCache::shard(const Key& publicKey) const {
+		// use a byte not consumed by ArrayHasher so that shard selection is independent of bucket selection
+		return m_pShards[publicKey[0] % Num_Shards];
+	}
+}}
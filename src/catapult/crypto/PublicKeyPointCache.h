@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <atomic>
+#include <memory>
+
+namespace catapult { namespace crypto {
+
+	/// Opaque decompressed (negated) ed25519 public key point.
+	struct alignas(16) DecompressedPublicKey {
+		/// Raw point data.
+		uint8_t Data[160];
+	};
+
+	/// Bounded, thread safe cache of decompressed public key points.
+	/// \note Cache is partitioned into independently locked shards and each shard evicts its least recently used point,
+	///       so a point can be evicted before the cache as a whole is full.
+	class PublicKeyPointCache {
+	private:
+		struct Shard;
+
+	public:
+		/// Creates a cache that holds at most \a maxSize points.
+		/// \note A \a maxSize of zero disables caching, in which case lookups are not counted as misses.
+		explicit PublicKeyPointCache(size_t maxSize);
+
+		/// Destroys the cache.
+		~PublicKeyPointCache();
+
+	public:
+		/// Gets the number of cached points.
+		size_t size() const;
+
+		/// Gets the number of lookups that found a cached point.
+		uint64_t numHits() const;
+
+		/// Gets the number of lookups that did not find a cached point.
+		uint64_t numMisses() const;
+
+	public:
+		/// Tries to find the decompressed point corresponding to \a publicKey and copies it into \a point when found.
+		bool tryFind(const Key& publicKey, DecompressedPublicKey& point);
+
+		/// Inserts decompressed \a point corresponding to \a publicKey, evicting the least recently used point when full.
+		void insert(const Key& publicKey, const DecompressedPublicKey& point);
+
+	private:
+		Shard& shard(const Key& publicKey) const;
+
+	private:
+		size_t m_maxSize;
+		std::unique_ptr<Shard[]> m_pShards;
+		std::atomic<uint64_t> m_numHits;
+		std::atomic<uint64_t> m_numMisses;
+	};
+}}
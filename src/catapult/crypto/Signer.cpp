@@ -21,6 +21,8 @@
 #include "Signer.h"
 #include "CryptoUtils.h"
 #include "Hashes.h"
+#include "PublicKeyPointCache.h"
+#include "SecureZero.h"
 #include "catapult/utils/RandomGenerator.h"
 #include "catapult/exceptions.h"
 #include <cstring>
@@ -109,6 +111,26 @@ namespace catapult { namespace crypto {
 				CATAPULT_THROW_OUT_OF_RANGE("S part of signature invalid");
 		}
 
+		static_assert(sizeof(ge25519) == sizeof(DecompressedPublicKey), "decompressed public key must be able to hold ge25519");
+
+		bool UnpackNegative(ge25519& point, const Key& publicKey, PublicKeyPointCache* pPointCache) {
+			if (!pPointCache)
+				return 1 == ge25519_unpack_negative_vartime(&point, publicKey.data());
+
+			DecompressedPublicKey decompressedPublicKey;
+			if (pPointCache->tryFind(publicKey, decompressedPublicKey)) {
+				std::memcpy(static_cast<void*>(&point), &decompressedPublicKey, sizeof(ge25519));
+				return true;
+			}
+
+			if (1 != ge25519_unpack_negative_vartime(&point, publicKey.data()))
+				return false;
+
+			std::memcpy(&decompressedPublicKey, static_cast<const void*>(&point), sizeof(ge25519));
+			pPointCache->insert(publicKey, decompressedPublicKey);
+			return true;
+		}
+
 #ifdef SIGNATURE_SCHEME_NIS1
 		using HashBuilder = Keccak_512_Builder;
 #else
@@ -118,114 +140,167 @@ namespace catapult { namespace crypto {
 
 	// region Sign
 
+	namespace {
+		void ExpandPrivateKey(const PrivateKey& privateKey, Hash512& expandedPrivateKey) {
+			// hash the private key to improve randomness
+			HashPrivateKey(privateKey, expandedPrivateKey);
+
+			// a = fieldElement(privHash[0:256])
+			expandedPrivateKey[0] &= 0xF8;
+			expandedPrivateKey[31] &= 0x7F;
+			expandedPrivateKey[31] |= 0x40;
+		}
+
+		void SignWithExpandedPrivateKey(
+				const Hash512& expandedPrivateKey,
+				const Key& publicKey,
+				std::initializer_list<const RawBuffer> buffersList,
+				Signature& computedSignature) {
+			uint8_t *RESTRICT encodedR = computedSignature.data();
+			uint8_t *RESTRICT encodedS = computedSignature.data() + Encoded_Size;
+
+			// r = H(privHash[256:512] || data)
+			// "EdDSA avoids these issues by generating r = H(h_b, ..., h_2b?1, M), so that
+			//  different messages will lead to different, hard-to-predict values of r."
+			Hash512 hash_r;
+			HashBuilder hasher_r;
+			hasher_r.update({ expandedPrivateKey.data() + Hash512::Size / 2, Hash512::Size / 2 });
+			hasher_r.update(buffersList);
+			hasher_r.final(hash_r);
+
+			bignum256modm r;
+			expand256_modm(r, hash_r.data(), 64);
+
+			// R = rModQ * base point
+			ge25519 ALIGN(16) R;
+			ge25519_scalarmult_base_niels(&R, ge25519_niels_base_multiples, r);
+			ge25519_pack(encodedR, &R);
+
+			// h = H(encodedR || public || data)
+			Hash512 hash_h;
+			HashBuilder hasher_h;
+			hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
+			hasher_h.update(buffersList);
+			hasher_h.final(hash_h);
+
+			bignum256modm h;
+			expand256_modm(h, hash_h.data(), 64);
+
+			bignum256modm a;
+			expand256_modm(a, expandedPrivateKey.data(), 32);
+
+			// S = (r + h * a) mod group order
+			bignum256modm S;
+			mul256_modm(S, h, a);
+			add256_modm(S, S, r);
+			contract256_modm(encodedS, S);
+
+			// signature is (encodedR, encodedS)
+
+			// throw if encodedS is not less than the group order, don't fail in case encodedS == 0
+			// (this should only throw if there is a bug in the signing code)
+			CheckEncodedS(encodedS);
+		}
+	}
+
 	void Sign(const KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& computedSignature) {
 		Sign(keyPair, { dataBuffer }, computedSignature);
 	}
 
 	void Sign(const KeyPair& keyPair, std::initializer_list<const RawBuffer> buffersList, Signature& computedSignature) {
-		uint8_t *RESTRICT encodedR = computedSignature.data();
-		uint8_t *RESTRICT encodedS = computedSignature.data() + Encoded_Size;
-
-		// hash the private key to improve randomness
-		Hash512 privHash;
-		HashPrivateKey(keyPair.privateKey(), privHash);
-
-		// r = H(privHash[256:512] || data)
-		// "EdDSA avoids these issues by generating r = H(h_b, ..., h_2b?1, M), so that
-		//  different messages will lead to different, hard-to-predict values of r."
-		Hash512 hash_r;
-		HashBuilder hasher_r;
-		hasher_r.update({ privHash.data() + Hash512::Size / 2, Hash512::Size / 2 });
-		hasher_r.update(buffersList);
-		hasher_r.final(hash_r);
-
-		bignum256modm r;
-		expand256_modm(r, hash_r.data(), 64);
-
-		// R = rModQ * base point
-		ge25519 ALIGN(16) R;
-		ge25519_scalarmult_base_niels(&R, ge25519_niels_base_multiples, r);
-		ge25519_pack(encodedR, &R);
-
-		// h = H(encodedR || public || data)
-		Hash512 hash_h;
-		HashBuilder hasher_h;
-		hasher_h.update({ { encodedR, Encoded_Size }, keyPair.publicKey() });
-		hasher_h.update(buffersList);
-		hasher_h.final(hash_h);
-
-		bignum256modm h;
-		expand256_modm(h, hash_h.data(), 64);
-
-		// a = fieldElement(privHash[0:256])
-		privHash[0] &= 0xF8;
-		privHash[31] &= 0x7F;
-		privHash[31] |= 0x40;
-
-		bignum256modm a;
-		expand256_modm(a, privHash.data(), 32);
-
-		// S = (r + h * a) mod group order
-		bignum256modm S;
-		mul256_modm(S, h, a);
-		add256_modm(S, S, r);
-		contract256_modm(encodedS, S);
-
-		// signature is (encodedR, encodedS)
-
-		// throw if encodedS is not less than the group order, don't fail in case encodedS == 0
-		// (this should only throw if there is a bug in the signing code)
-		CheckEncodedS(encodedS);
+		Signer(keyPair).sign(buffersList, computedSignature);
 	}
 
 	// endregion
 
-	// region Verify
+	// region Signer
 
-	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
-		return Verify(publicKey, std::vector<RawBuffer>{ dataBuffer }, signature);
+	Signer::Signer(const KeyPair& keyPair) : m_publicKey(keyPair.publicKey()) {
+		ExpandPrivateKey(keyPair.privateKey(), m_expandedPrivateKey);
 	}
 
-	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffers, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+	Signer::~Signer() {
+		SecureZero(m_expandedPrivateKey.data(), m_expandedPrivateKey.size());
+	}
 
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
+	const Key& Signer::publicKey() const {
+		return m_publicKey;
+	}
 
-		// reject zero public key, which is known weak key
-		if (Key() == publicKey)
-			return false;
+	void Signer::sign(const RawBuffer& dataBuffer, Signature& computedSignature) const {
+		sign({ dataBuffer }, computedSignature);
+	}
 
-		// h = H(encodedR || public || data)
-		Hash512 hash_h;
-		HashBuilder hasher_h;
-		hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
-		for (const auto& buffer : buffers)
-			hasher_h.update(buffer);
+	void Signer::sign(std::initializer_list<const RawBuffer> buffersList, Signature& computedSignature) const {
+		SignWithExpandedPrivateKey(m_expandedPrivateKey, m_publicKey, buffersList, computedSignature);
+	}
 
-		hasher_h.final(hash_h);
+	// endregion
 
-		bignum256modm h;
-		expand256_modm(h, hash_h.data(), 64);
+	// region Verify
 
-		// A = -pub
-		ge25519 ALIGN(16) A;
-		if (!ge25519_unpack_negative_vartime(&A, publicKey.data()))
-			return false;
+	namespace {
+		bool VerifySignature(
+				const Key& publicKey,
+				const std::vector<RawBuffer>& buffers,
+				const Signature& signature,
+				PublicKeyPointCache* pPointCache) {
+			const uint8_t *RESTRICT encodedR = signature.data();
+			const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(encodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			if (Key() == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Hash512 hash_h;
+			HashBuilder hasher_h;
+			hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
+			for (const auto& buffer : buffers)
+				hasher_h.update(buffer);
+
+			hasher_h.final(hash_h);
+
+			bignum256modm h;
+			expand256_modm(h, hash_h.data(), 64);
+
+			// A = -pub
+			ge25519 ALIGN(16) A;
+			if (!UnpackNegative(A, publicKey, pPointCache))
+				return false;
+
+			bignum256modm S;
+			expand256_modm(S, encodedS, 32);
+
+			// R = encodedS * B - h * A
+			ge25519 ALIGN(16) R;
+			ge25519_double_scalarmult_vartime(&R, &A, h, S);
+
+			// compare calculated R to given R
+			uint8_t checkr[Encoded_Size];
+			ge25519_pack(checkr, &R);
+			return 1 == ed25519_verify(encodedR, checkr, 32);
+		}
+	}
 
-		bignum256modm S;
-		expand256_modm(S, encodedS, 32);
+	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
+		return Verify(publicKey, std::vector<RawBuffer>{ dataBuffer }, signature);
+	}
 
-		// R = encodedS * B - h * A
-		ge25519 ALIGN(16) R;
-		ge25519_double_scalarmult_vartime(&R, &A, h, S);
+	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffers, const Signature& signature) {
+		return VerifySignature(publicKey, buffers, signature, nullptr);
+	}
 
-		// compare calculated R to given R
-		uint8_t checkr[Encoded_Size];
-		ge25519_pack(checkr, &R);
-		return 1 == ed25519_verify(encodedR, checkr, 32);
+	bool Verify(
+			const Key& publicKey,
+			const std::vector<RawBuffer>& buffers,
+			const Signature& signature,
+			PublicKeyPointCache& pointCache) {
+		return VerifySignature(publicKey, buffers, signature, &pointCache);
 	}
 
 	// endregion
@@ -252,10 +327,16 @@ namespace catapult { namespace crypto {
 			return std::make_pair(valid, aggregateResult);
 		}
 
-		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
+		bool VerifySingle(
+				const SignatureInput* pSignatureInputs,
+				size_t offset,
+				size_t count,
+				std::vector<bool>& valid,
+				PublicKeyPointCache* pPointCache) {
 			bool aggregateResult = true;
 			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				const auto& input = pSignatureInputs[offset + i];
+				valid[offset + i] = VerifySignature(input.PublicKey, input.Buffers, input.Signature, pPointCache);
 				aggregateResult &= valid[offset + i];
 			}
 
@@ -266,6 +347,7 @@ namespace catapult { namespace crypto {
 				const SignatureInput* pSignatureInputs,
 				size_t count,
 				std::pair<std::vector<bool>, bool>& result,
+				PublicKeyPointCache* pPointCache,
 				const predicate<size_t, size_t>& fallback) {
 			size_t offset = 0;
 			batch_heap ALIGN(16) batch;
@@ -310,7 +392,7 @@ namespace catapult { namespace crypto {
 				bool success = true;
 				for (auto i = 0u; i < batchSize; ++i) {
 					const auto& signatureInput = pSignatureInputs[offset + i];
-					success &= 1 == ge25519_unpack_negative_vartime(&batch.points[i + 1], signatureInput.PublicKey.data());
+					success &= UnpackNegative(batch.points[i + 1], signatureInput.PublicKey, pPointCache);
 					success &= 1 == ge25519_unpack_negative_vartime(&batch.points[batchSize + i + 1], signatureInput.Signature.data());
 					if (!success)
 						break;
@@ -329,25 +411,46 @@ namespace catapult { namespace crypto {
 				offset += batchSize;
 			}
 
-			aggregateResult &= VerifySingle(pSignatureInputs, offset, count, result.first);
+			aggregateResult &= VerifySingle(pSignatureInputs, offset, count, result.first, pPointCache);
 			return aggregateResult;
 		}
+
+		std::pair<std::vector<bool>, bool> VerifyMultiAll(
+				const SignatureInput* pSignatureInputs,
+				size_t count,
+				PublicKeyPointCache* pPointCache) {
+			auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
+			VerifyBatches(pSignatureInputs, count, result, pPointCache, [pSignatureInputs, &result, pPointCache](
+					auto offset,
+					auto batchSize) {
+				result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first, pPointCache);
+				return true;
+			});
+			return result;
+		}
+
+		bool VerifyMultiAny(const SignatureInput* pSignatureInputs, size_t count, PublicKeyPointCache* pPointCache) {
+			auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
+			return result.second && VerifyBatches(pSignatureInputs, count, result, pPointCache, [](auto, auto) {
+				return false;
+			});
+		}
 	}
 
 	std::pair<std::vector<bool>, bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count) {
-		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		VerifyBatches(pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
-			result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first);
-			return true;
-		});
-		return result;
+		return VerifyMultiAll(pSignatureInputs, count, nullptr);
+	}
+
+	std::pair<std::vector<bool>, bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count, PublicKeyPointCache& pointCache) {
+		return VerifyMultiAll(pSignatureInputs, count, &pointCache);
 	}
 
 	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count) {
-		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		return result.second && VerifyBatches(pSignatureInputs, count, result, [](auto, auto) {
-			return false;
-		});
+		return VerifyMultiAny(pSignatureInputs, count, nullptr);
+	}
+
+	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count, PublicKeyPointCache& pointCache) {
+		return VerifyMultiAny(pSignatureInputs, count, &pointCache);
 	}
 
 	// endregion
@@ -20,8 +20,11 @@
 
 #pragma once
 #include "KeyPair.h"
+#include "catapult/utils/NonCopyable.h"
 #include <vector>
 
+namespace catapult { namespace crypto { class PublicKeyPointCache; } }
+
 namespace catapult { namespace crypto {
 
 	/// Signature input.
@@ -44,6 +47,35 @@ namespace catapult { namespace crypto {
 	/// \note The function will throw if the generated S part of the signature is not less than the group order.
 	void Sign(const KeyPair& keyPair, std::initializer_list<const RawBuffer> buffersList, Signature& computedSignature);
 
+	/// Signer that signs data using a single key pair.
+	/// \note Private key is expanded once upon construction instead of upon every signing
+	///       and the expanded private key is securely zeroed upon destruction.
+	class Signer : public utils::NonCopyable {
+	public:
+		/// Creates a signer around \a keyPair.
+		explicit Signer(const KeyPair& keyPair);
+
+		/// Destroys the signer.
+		~Signer();
+
+	public:
+		/// Gets the public key used by the signer.
+		const Key& publicKey() const;
+
+	public:
+		/// Signs data pointed by \a dataBuffer, placing resulting signature in \a computedSignature.
+		/// \note The function will throw if the generated S part of the signature is not less than the group order.
+		void sign(const RawBuffer& dataBuffer, Signature& computedSignature) const;
+
+		/// Signs data in \a buffersList, placing resulting signature in \a computedSignature.
+		/// \note The function will throw if the generated S part of the signature is not less than the group order.
+		void sign(std::initializer_list<const RawBuffer> buffersList, Signature& computedSignature) const;
+
+	private:
+		Hash512 m_expandedPrivateKey;
+		Key m_publicKey;
+	};
+
 	/// Verifies that \a signature of data pointed by \a dataBuffer is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature);
@@ -52,12 +84,32 @@ namespace catapult { namespace crypto {
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffersList, const Signature& signature);
 
+	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
+	/// Decompressed public key points are looked up in and added to \a pointCache.
+	/// Returns \c true if signature is valid.
+	bool Verify(
+			const Key& publicKey,
+			const std::vector<RawBuffer>& buffersList,
+			const Signature& signature,
+			PublicKeyPointCache& pointCache);
+
 	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
 	/// Returns a pair consisting of an aggregate result that is \c true when all signatures are valid
 	/// and a vector of bools that indicates the verification result for each signature.
 	std::pair<std::vector<bool>, bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count);
 
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid using \a pointCache
+	/// to cache decompressed public key points.
+	/// Returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each signature.
+	std::pair<std::vector<bool>, bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count, PublicKeyPointCache& pointCache);
+
 	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
 	/// Returns \c true if all signatures are valid.
 	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid using \a pointCache
+	/// to cache decompressed public key points.
+	/// Returns \c true if all signatures are valid.
+	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count, PublicKeyPointCache& pointCache);
 }}
@@ -126,6 +126,12 @@ namespace catapult { namespace deltaset {
 			return iter;
 		}
 
+		/// Searches for \a key in the original set, ignoring all pending modifications.
+		/// Returns a pointer to the matching original element if it is found or \c nullptr if it is not found.
+		FindConstIterator findOriginal(const KeyType& key) const {
+			return find(key, ImmutableTypeTag());
+		}
+
 	private:
 		template<typename TResultIterator, typename TBaseSetDelta>
 		static TResultIterator Find(TBaseSetDelta& set, const KeyType& key) {
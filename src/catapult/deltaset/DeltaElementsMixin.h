@@ -22,6 +22,7 @@
 #include "BaseSetDefaultTraits.h"
 #include "catapult/utils/traits/StlTraits.h"
 #include <unordered_set>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -38,6 +39,10 @@ namespace catapult { namespace deltaset {
 			static const ValueType* GetPointer(const typename TSet::value_type& value) {
 				return &value;
 			}
+
+			static const ValueType& GetKey(const typename TSet::value_type& value) {
+				return value;
+			}
 		};
 
 		template<typename TSet>
@@ -47,6 +52,10 @@ namespace catapult { namespace deltaset {
 			static const ValueType* GetPointer(const typename TSet::value_type& pair) {
 				return &pair.second;
 			}
+
+			static const typename TSet::key_type& GetKey(const typename TSet::value_type& pair) {
+				return pair.first;
+			}
 		};
 
 		// endregion
@@ -78,7 +87,26 @@ namespace catapult { namespace deltaset {
 			return CollectAllPointers(m_setDelta.deltas().Removed);
 		}
 
+		/// Gets copies of the original values of all modified and removed elements.
+		std::vector<ValueType> originalElements() const {
+			std::vector<ValueType> values;
+			auto deltas = m_setDelta.deltas();
+			appendOriginalValues(deltas.Copied, values);
+			appendOriginalValues(deltas.Removed, values);
+			return values;
+		}
+
 	private:
+		template<typename TSource>
+		void appendOriginalValues(const TSource& source, std::vector<ValueType>& values) const {
+			for (const auto& element : source) {
+				// elements that were temporarily added by the delta are also removed but have no original value
+				auto iter = m_setDelta.findOriginal(ValueAccessor::GetKey(element));
+				if (iter.get())
+					values.push_back(*iter.get());
+			}
+		}
+
 		template<typename TSource>
 		static PointerContainer CollectAllPointers(const TSource& source) {
 			PointerContainer dest;
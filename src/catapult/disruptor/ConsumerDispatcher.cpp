@@ -65,7 +65,9 @@ namespace catapult { namespace disruptor {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
+			auto pLatency = std::make_shared<utils::LatencyHistogram>();
+			m_consumerLatencies.push_back(pLatency);
+			m_threads.create_thread([pThis = this, consumerEntry, consumer, pLatency]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
@@ -74,7 +76,12 @@ namespace catapult { namespace disruptor {
 						continue;
 					}
 
-					auto result = consumer(pDisruptorElement->input());
+					ConsumerResult result;
+					{
+						utils::LatencyRecorder recorder(*pLatency);
+						result = consumer(pDisruptorElement->input());
+					}
+
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
 
@@ -111,6 +118,10 @@ namespace catapult { namespace disruptor {
 		return m_numActiveElements.load();
 	}
 
+	std::vector<std::shared_ptr<const utils::LatencyHistogram>> ConsumerDispatcher::consumerLatencies() const {
+		return std::vector<std::shared_ptr<const utils::LatencyHistogram>>(m_consumerLatencies.cbegin(), m_consumerLatencies.cend());
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -23,6 +23,7 @@
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/NamedObject.h"
 #include <boost/thread.hpp>
 #include <atomic>
@@ -70,6 +71,9 @@ namespace catapult { namespace disruptor {
 		/// Returns the number of elements currently in the disruptor.
 		size_t numActiveElements() const;
 
+		/// Returns the processing latency histograms of all registered consumers ordered by level.
+		std::vector<std::shared_ptr<const utils::LatencyHistogram>> consumerLatencies() const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
@@ -86,6 +90,7 @@ namespace catapult { namespace disruptor {
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
+		std::vector<std::shared_ptr<utils::LatencyHistogram>> m_consumerLatencies;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
 
@@ -23,6 +23,7 @@
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "catapult/utils/TimeSpan.h"
 
 namespace catapult { namespace extensions {
@@ -51,6 +52,15 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	void AddDispatcherLatencies(
+			utils::LatencyHistogramRegistry& registry,
+			const disruptor::ConsumerDispatcher& dispatcher,
+			const std::string& counterPrefix) {
+		auto level = 0u;
+		for (const auto& pLatency : dispatcher.consumerLatencies())
+			registry.add(counterPrefix + " ELEM LAT", level++, pLatency);
+	}
+
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
 		return thread::CreateNamedTask("batch " + name + " task", [&dispatcher]() {
 			dispatcher.dispatch();
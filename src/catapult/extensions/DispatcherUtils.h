@@ -28,6 +28,7 @@ namespace catapult {
 	namespace config { struct NodeConfiguration; }
 	namespace extensions { class ServiceLocator; }
 	namespace subscribers { class TransactionStatusSubscriber; }
+	namespace utils { class LatencyHistogramRegistry; }
 }
 
 namespace catapult { namespace extensions {
@@ -41,6 +42,12 @@ namespace catapult { namespace extensions {
 	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
+	/// Adds the consumer latency histograms of \a dispatcher with prefix \a counterPrefix to \a registry.
+	void AddDispatcherLatencies(
+			utils::LatencyHistogramRegistry& registry,
+			const disruptor::ConsumerDispatcher& dispatcher,
+			const std::string& counterPrefix);
+
 	/// A transaction batch range dispatcher.
 	using TransactionBatchRangeDispatcher = disruptor::BatchRangeDispatcher<model::AnnotatedTransactionRange>;
 
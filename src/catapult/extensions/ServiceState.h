@@ -41,7 +41,10 @@ namespace catapult {
 		class TransactionStatusSubscriber;
 	}
 	namespace thread { class MultiServicePool; }
-	namespace utils { class DiagnosticCounter; }
+	namespace utils {
+		class DiagnosticCounter;
+		class LatencyHistogramRegistry;
+	}
 }
 
 namespace catapult { namespace extensions {
@@ -50,7 +53,8 @@ namespace catapult { namespace extensions {
 	class ServiceState {
 	public:
 		/// Creates service state around \a config, \a nodes, \a cache, \a storage, \a score, \a utCache, \a timeSupplier
-		/// \a transactionStatusSubscriber, \a stateChangeSubscriber, \a nodeSubscriber, \a counters, \a pluginManager and \a pool.
+		/// \a transactionStatusSubscriber, \a stateChangeSubscriber, \a nodeSubscriber, \a counters, \a latencyHistograms,
+		/// \a pluginManager and \a pool.
 		ServiceState(
 				const config::CatapultConfiguration& config,
 				ionet::NodeContainer& nodes,
@@ -63,6 +67,7 @@ namespace catapult { namespace extensions {
 				subscribers::StateChangeSubscriber& stateChangeSubscriber,
 				subscribers::NodeSubscriber& nodeSubscriber,
 				const std::vector<utils::DiagnosticCounter>& counters,
+				utils::LatencyHistogramRegistry& latencyHistograms,
 				const plugins::PluginManager& pluginManager,
 				thread::MultiServicePool& pool)
 				: m_config(config)
@@ -76,6 +81,7 @@ namespace catapult { namespace extensions {
 				, m_stateChangeSubscriber(stateChangeSubscriber)
 				, m_nodeSubscriber(nodeSubscriber)
 				, m_counters(counters)
+				, m_latencyHistograms(latencyHistograms)
 				, m_pluginManager(pluginManager)
 				, m_pool(pool)
 				, m_packetHandlers(m_config.Node.MaxPacketDataSize.bytes32())
@@ -138,6 +144,11 @@ namespace catapult { namespace extensions {
 			return m_counters;
 		}
 
+		/// Gets the latency histograms.
+		auto& latencyHistograms() const {
+			return m_latencyHistograms;
+		}
+
 		/// Gets the plugin manager.
 		const auto& pluginManager() const {
 			return m_pluginManager;
@@ -188,6 +199,7 @@ namespace catapult { namespace extensions {
 		subscribers::NodeSubscriber& m_nodeSubscriber;
 
 		const std::vector<utils::DiagnosticCounter>& m_counters;
+		utils::LatencyHistogramRegistry& m_latencyHistograms;
 		const plugins::PluginManager& m_pluginManager;
 		thread::MultiServicePool& m_pool;
 
@@ -27,7 +27,9 @@
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticLatencyValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 
 namespace catapult { namespace handlers {
 
@@ -61,6 +63,42 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticLatenciesHandler
+
+	namespace {
+		auto CreateDiagnosticLatenciesHandler(const utils::LatencyHistogramRegistry& registry) {
+			return [&registry](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Diagnostic_Latencies))
+					return;
+
+				auto entries = registry.entries();
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(entries.size() * sizeof(model::DiagnosticLatencyValue));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Diagnostic_Latencies;
+
+				auto* pLatencyValue = reinterpret_cast<model::DiagnosticLatencyValue*>(pResponsePacket->Data());
+				for (const auto& entry : entries) {
+					const auto& histogram = *entry.pHistogram;
+					pLatencyValue->Id = entry.Id.value();
+					pLatencyValue->Index = entry.Index;
+					pLatencyValue->Count = histogram.count();
+					pLatencyValue->Median = histogram.percentile(50);
+					pLatencyValue->Percentile99 = histogram.percentile(99);
+					pLatencyValue->Max = histogram.max();
+					++pLatencyValue;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticLatenciesHandler(ionet::ServerPacketHandlers& handlers, const utils::LatencyHistogramRegistry& registry) {
+		handlers.registerHandler(ionet::PacketType::Diagnostic_Latencies, CreateDiagnosticLatenciesHandler(registry));
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	namespace {
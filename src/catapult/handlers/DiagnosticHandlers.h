@@ -25,7 +25,10 @@
 namespace catapult {
 	namespace io { class BlockStorageCache; }
 	namespace ionet { class NodeContainer; }
-	namespace utils { class DiagnosticCounter; }
+	namespace utils {
+		class DiagnosticCounter;
+		class LatencyHistogramRegistry;
+	}
 }
 
 namespace catapult { namespace handlers {
@@ -33,6 +36,9 @@ namespace catapult { namespace handlers {
 	/// Registers a diagnostic counters handler in \a handlers that responds with the current values of \a counters.
 	void RegisterDiagnosticCountersHandler(ionet::ServerPacketHandlers& handlers, const std::vector<utils::DiagnosticCounter>& counters);
 
+	/// Registers a diagnostic latencies handler in \a handlers that responds with summaries of all histograms in \a registry.
+	void RegisterDiagnosticLatenciesHandler(ionet::ServerPacketHandlers& handlers, const utils::LatencyHistogramRegistry& registry);
+
 	/// Registers a diagnostic nodes handler in \a handlers that responds with info about all (active) partner nodes in \a nodeContainer.
 	void RegisterDiagnosticNodesHandler(ionet::ServerPacketHandlers& handlers, const ionet::NodeContainer& nodeContainer);
 
@@ -31,6 +31,16 @@ namespace catapult { namespace io {
 		}
 	}
 
+	// region BlockStorageCacheLatencies
+
+	BlockStorageCacheLatencies::BlockStorageCacheLatencies()
+			: pLoad(std::make_shared<utils::LatencyHistogram>())
+			, pSave(std::make_shared<utils::LatencyHistogram>())
+			, pCommit(std::make_shared<utils::LatencyHistogram>())
+	{}
+
+	// endregion
+
 	// region CachedData
 
 	struct CachedData {
@@ -71,39 +81,56 @@ namespace catapult { namespace io {
 
 	BlockStorageView::BlockStorageView(
 			const BlockStorage& storage,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-			const CachedData& cachedData)
+			utils::SpinReaderWriterLock& lock,
+			utils::ReadMostlyValue<CachedData>::View&& cachedDataView,
+			const BlockStorageCacheLatencies& latencies)
 			: m_storage(storage)
-			, m_readLock(std::move(readLock))
-			, m_cachedData(cachedData)
+			, m_lock(lock)
+			, m_cachedDataView(std::move(cachedDataView))
+			, m_loadLatency(*latencies.pLoad)
 	{}
 
 	Height BlockStorageView::chainHeight() const {
-		return m_cachedData.height();
+		return m_cachedDataView->height();
 	}
 
 	model::HashRange BlockStorageView::loadHashesFrom(Height height, size_t maxHashes) const {
-		return m_storage.loadHashesFrom(height, maxHashes);
+		// storage might contain blocks that were committed after this view was created, so don't return their hashes
+		auto chainHeight = this->chainHeight();
+		if (height > chainHeight)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((chainHeight - height).unwrap() + 1);
+		utils::LatencyRecorder recorder(m_loadLatency);
+		auto readLock = m_lock.acquireReader();
+		return m_storage.loadHashesFrom(height, std::min(maxHashes, numAvailableHashes));
 	}
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
 		requireHeight(height, "block");
-		if (m_cachedData.contains(height))
-			return m_cachedData.block(height);
+		if (m_cachedDataView->contains(height))
+			return m_cachedDataView->block(height);
 
+		utils::LatencyRecorder recorder(m_loadLatency);
+		auto readLock = m_lock.acquireReader();
 		return m_storage.loadBlock(height);
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
-		if (m_cachedData.contains(height))
-			return m_cachedData.blockElement(height);
+		if (m_cachedDataView->contains(height))
+			return m_cachedDataView->blockElement(height);
 
+		utils::LatencyRecorder recorder(m_loadLatency);
+		auto readLock = m_lock.acquireReader();
 		return m_storage.loadBlockElement(height);
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
+
+		utils::LatencyRecorder recorder(m_loadLatency);
+		auto readLock = m_lock.acquireReader();
 		return m_storage.loadBlockStatementData(height);
 	}
 
@@ -121,24 +148,39 @@ namespace catapult { namespace io {
 
 	// region BlockStorageModifier
 
+	namespace {
+		void UpdateCachedData(CachedData& cachedData, const BlockStorage& storage, Height height) {
+			if (height > Height(0))
+				cachedData.update(storage.loadBlockElement(height));
+			else
+				cachedData.reset();
+		}
+	}
+
 	BlockStorageModifier::BlockStorageModifier(
 			BlockStorage& storage,
 			PrunableBlockStorage& stagingStorage,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-			CachedData& cachedData)
+			std::unique_lock<std::mutex>&& modifierLock,
+			utils::SpinReaderWriterLock& lock,
+			utils::ReadMostlyValue<CachedData>& cachedData,
+			const BlockStorageCacheLatencies& latencies)
 			: m_storage(storage)
 			, m_stagingStorage(stagingStorage)
-			, m_readLock(std::move(readLock))
-			, m_writeLock(m_readLock.promoteToWriter())
-			, m_cachedData(cachedData) {
+			, m_modifierLock(std::move(modifierLock))
+			, m_lock(lock)
+			, m_cachedData(cachedData)
+			, m_saveLatency(*latencies.pSave)
+			, m_commitLatency(*latencies.pCommit) {
 		dropBlocksAfter(storage.chainHeight());
 	}
 
 	void BlockStorageModifier::saveBlock(const model::BlockElement& blockElement) {
+		utils::LatencyRecorder recorder(m_saveLatency);
 		m_stagingStorage.saveBlock(blockElement);
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		utils::LatencyRecorder recorder(m_saveLatency);
 		for (const auto& blockElement : blockElements)
 			m_stagingStorage.saveBlock(blockElement);
 	}
@@ -149,15 +191,22 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::commit() {
-		// 1. apply staging changes to permananent storage
+		utils::LatencyRecorder recorder(m_commitLatency);
+
+		// 1. when blocks are rolled back, publish the common chain (which is unaffected by the commit) and wait for all views
+		//    that can observe rolled back blocks to be destroyed
+		if (m_saveStartHeight < m_storage.chainHeight()) {
+			UpdateCachedData(*m_cachedData.modifier(), m_storage, m_saveStartHeight);
+			m_cachedData.synchronize();
+		}
+
+		// 2. apply staging changes to permananent storage
+		auto readLock = m_lock.acquireReader();
+		auto writeLock = readLock.promoteToWriter();
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
-		// 2. update cache
-		auto newChainHeight = m_storage.chainHeight();
-		if (newChainHeight > Height(0))
-			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
-		else
-			m_cachedData.reset();
+		// 3. update cache
+		UpdateCachedData(*m_cachedData.modifier(), m_storage, m_storage.chainHeight());
 	}
 
 	// endregion
@@ -167,18 +216,23 @@ namespace catapult { namespace io {
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
-		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
+			, m_pCachedData(std::make_unique<utils::ReadMostlyValue<CachedData>>()) {
+		m_pCachedData->modifier()->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
 	BlockStorageCache::~BlockStorageCache() = default;
 
 	BlockStorageView BlockStorageCache::view() const {
-		return BlockStorageView(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
+		return BlockStorageView(*m_pStorage, m_lock, m_pCachedData->view(), m_latencies);
 	}
 
 	BlockStorageModifier BlockStorageCache::modifier() {
-		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, m_lock.acquireReader(), *m_pCachedData);
+		std::unique_lock<std::mutex> modifierLock(m_modifierMutex);
+		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(modifierLock), m_lock, *m_pCachedData, m_latencies);
+	}
+
+	const BlockStorageCacheLatencies& BlockStorageCache::latencies() const {
+		return m_latencies;
 	}
 
 	// endregion
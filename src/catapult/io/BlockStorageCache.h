@@ -20,20 +20,42 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/utils/ReadMostlyValue.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
 
 namespace catapult { namespace io {
 
+	/// Latency histograms of block storage cache operations.
+	struct BlockStorageCacheLatencies {
+	public:
+		/// Creates empty histograms.
+		BlockStorageCacheLatencies();
+
+	public:
+		/// Latencies of view loads.
+		std::shared_ptr<utils::LatencyHistogram> pLoad;
+
+		/// Latencies of modifier saves.
+		std::shared_ptr<utils::LatencyHistogram> pSave;
+
+		/// Latencies of modifier commits.
+		std::shared_ptr<utils::LatencyHistogram> pCommit;
+	};
+
 	/// A read only view on top of block storage.
+	/// \note The view is backed by an immutable snapshot of the chain height and is not blocked by modifiers.
 	class BlockStorageView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
+		/// Creates a view around \a storage and a cache data snapshot (\a cachedDataView) that uses \a lock to synchronize storage access
+		/// and records load latencies in \a latencies.
 		BlockStorageView(
 				const BlockStorage& storage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				const CachedData& cachedData);
+				utils::SpinReaderWriterLock& lock,
+				utils::ReadMostlyValue<CachedData>::View&& cachedDataView,
+				const BlockStorageCacheLatencies& latencies);
 
 	public:
 		/// Gets the number of blocks.
@@ -56,19 +78,23 @@ namespace catapult { namespace io {
 
 	private:
 		const BlockStorage& m_storage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		const CachedData& m_cachedData;
+		utils::SpinReaderWriterLock& m_lock;
+		utils::ReadMostlyValue<CachedData>::View m_cachedDataView;
+		utils::LatencyHistogram& m_loadLatency;
 	};
 
 	/// A write only view on top of block storage.
 	class BlockStorageModifier : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage, \a stagingStorage and cache data (\a cachedData) with lock context \a readLock.
+		/// Creates a view around \a storage, \a stagingStorage and cache data (\a cachedData) with modifier lock context \a modifierLock
+		/// that uses \a lock to synchronize storage access and records save and commit latencies in \a latencies.
 		BlockStorageModifier(
 				BlockStorage& storage,
 				PrunableBlockStorage& stagingStorage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				CachedData& cachedData);
+				std::unique_lock<std::mutex>&& modifierLock,
+				utils::SpinReaderWriterLock& lock,
+				utils::ReadMostlyValue<CachedData>& cachedData,
+				const BlockStorageCacheLatencies& latencies);
 
 	public:
 		/// Saves a block element (\a blockElement).
@@ -81,14 +107,17 @@ namespace catapult { namespace io {
 		void dropBlocksAfter(Height height);
 
 		/// Commits all staged changes to the primary storage.
+		/// \note When blocks are rolled back, this waits for all views that can observe the rolled back blocks to be destroyed.
 		void commit();
 
 	private:
 		BlockStorage& m_storage;
 		PrunableBlockStorage& m_stagingStorage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
-		CachedData& m_cachedData;
+		std::unique_lock<std::mutex> m_modifierLock;
+		utils::SpinReaderWriterLock& m_lock;
+		utils::ReadMostlyValue<CachedData>& m_cachedData;
+		utils::LatencyHistogram& m_saveLatency;
+		utils::LatencyHistogram& m_commitLatency;
 		Height m_saveStartHeight;
 	};
 
@@ -109,10 +138,15 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the operation latency histograms.
+		const BlockStorageCacheLatencies& latencies() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
-		std::unique_ptr<CachedData> m_pCachedData;
+		std::unique_ptr<utils::ReadMostlyValue<CachedData>> m_pCachedData;
+		std::mutex m_modifierMutex;
 		mutable utils::SpinReaderWriterLock m_lock;
+		BlockStorageCacheLatencies m_latencies;
 	};
 }}
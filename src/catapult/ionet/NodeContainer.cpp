@@ -62,11 +62,9 @@ namespace catapult { namespace ionet {
 
 	// region NodeContainerView
 
-	NodeContainerView::NodeContainerView(
-			const NodeContainerData& nodeContainerData,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
-			: m_nodeContainerData(nodeContainerData)
-			, m_readLock(std::move(readLock))
+	NodeContainerView::NodeContainerView(utils::ReadMostlyValue<NodeContainerData>::View&& dataView)
+			: m_dataView(std::move(dataView))
+			, m_nodeContainerData(*m_dataView)
 	{}
 
 	size_t NodeContainerView::size() const {
@@ -98,14 +96,15 @@ namespace catapult { namespace ionet {
 
 	// region NodeContainerModifier
 
-	NodeContainerModifier::NodeContainerModifier(
-			NodeContainerData& nodeContainerData,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
-			: m_nodeContainerData(nodeContainerData)
-			, m_readLock(std::move(readLock))
-			, m_writeLock(m_readLock.promoteToWriter())
+	NodeContainerModifier::NodeContainerModifier(utils::ReadMostlyValue<NodeContainerData>::Modifier&& dataModifier)
+			: m_dataModifier(std::move(dataModifier))
+			, m_nodeContainerData(*m_dataModifier)
 	{}
 
+	NodeContainerModifier::NodeContainerModifier(NodeContainerModifier&&) = default;
+
+	NodeContainerModifier::~NodeContainerModifier() = default;
+
 	bool NodeContainerModifier::add(const Node& node, NodeSource source) {
 		auto iter = m_nodeContainerData.NodeDataContainer.find(node.identityKey());
 		if (m_nodeContainerData.NodeDataContainer.end() == iter) {
@@ -241,19 +240,17 @@ namespace catapult { namespace ionet {
 	{}
 
 	NodeContainer::NodeContainer(size_t maxNodes, const supplier<Timestamp>& timeSupplier)
-			: m_pImpl(std::make_unique<NodeContainerData>(maxNodes, timeSupplier))
+			: m_data(maxNodes, timeSupplier)
 	{}
 
 	NodeContainer::~NodeContainer() = default;
 
 	NodeContainerView NodeContainer::view() const {
-		auto readLock = m_lock.acquireReader();
-		return NodeContainerView(*m_pImpl, std::move(readLock));
+		return NodeContainerView(m_data.view());
 	}
 
 	NodeContainerModifier NodeContainer::modifier() {
-		auto readLock = m_lock.acquireReader();
-		return NodeContainerModifier(*m_pImpl, std::move(readLock));
+		return NodeContainerModifier(m_data.modifier());
 	}
 
 	// endregion
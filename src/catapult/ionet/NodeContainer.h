@@ -22,7 +22,7 @@
 #include "Node.h"
 #include "NodeInfo.h"
 #include "catapult/utils/ArraySet.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReadMostlyValue.h"
 #include <unordered_map>
 
 namespace catapult {
@@ -36,10 +36,11 @@ namespace catapult {
 namespace catapult { namespace ionet {
 
 	/// A read only view on top of node container.
+	/// \note The view is backed by an immutable version of the container and is never blocked by modifiers.
 	class NodeContainerView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a nodeContainerData with lock context \a readLock.
-		NodeContainerView(const NodeContainerData& nodeContainerData, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around a published version of node container data (\a dataView).
+		explicit NodeContainerView(utils::ReadMostlyValue<NodeContainerData>::View&& dataView);
 
 	public:
 		/// Returns the number of nodes.
@@ -58,15 +59,22 @@ namespace catapult { namespace ionet {
 		void forEach(const consumer<const Node&, const NodeInfo&>& consumer) const;
 
 	private:
+		utils::ReadMostlyValue<NodeContainerData>::View m_dataView;
 		const NodeContainerData& m_nodeContainerData;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// A write only view on top of node container.
+	/// \note All changes are made to a private copy of the container that is published when the modifier is destroyed.
 	class NodeContainerModifier : utils::MoveOnly {
 	public:
-		/// Creates a view around \a nodeContainerData with lock context \a readLock.
-		NodeContainerModifier(NodeContainerData& nodeContainerData, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around a private copy of node container data (\a dataModifier).
+		explicit NodeContainerModifier(utils::ReadMostlyValue<NodeContainerData>::Modifier&& dataModifier);
+
+		/// Move constructor.
+		NodeContainerModifier(NodeContainerModifier&& rhs);
+
+		/// Destroys the modifier and publishes all changes.
+		~NodeContainerModifier();
 
 	public:
 		/// Adds \a node to the collection with \a source.
@@ -100,9 +108,8 @@ namespace catapult { namespace ionet {
 		void incrementInteraction(const Key& identityKey, const consumer<NodeInfo&>& incrementer);
 
 	private:
+		utils::ReadMostlyValue<NodeContainerData>::Modifier m_dataModifier;
 		NodeContainerData& m_nodeContainerData;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// A collection of nodes.
@@ -125,8 +132,7 @@ namespace catapult { namespace ionet {
 		NodeContainerModifier modifier();
 
 	private:
-		std::unique_ptr<NodeContainerData> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		utils::ReadMostlyValue<NodeContainerData> m_data;
 	};
 
 	/// Finds all active nodes in \a view.
@@ -109,10 +109,21 @@ namespace catapult { namespace ionet {
 		}
 
 		CATAPULT_LOG(trace) << "processing " << packet;
+		utils::LatencyRecorder recorder(*pDescriptor->pLatency);
 		pDescriptor->Handler(packet, context);
 		return true;
 	}
 
+	ServerPacketHandlers::HandlerLatencies ServerPacketHandlers::handlerLatencies() const {
+		HandlerLatencies latencies;
+		for (auto i = 0u; i < m_descriptors.size(); ++i) {
+			if (m_descriptors[i].Handler)
+				latencies.emplace_back(static_cast<PacketType>(i), m_descriptors[i].pLatency);
+		}
+
+		return latencies;
+	}
+
 	void ServerPacketHandlers::setAllowedHosts(const std::unordered_set<std::string>& hosts) {
 		m_activeAllowedHosts = hosts;
 	}
@@ -125,7 +136,7 @@ namespace catapult { namespace ionet {
 		if (m_descriptors[rawType].Handler)
 			CATAPULT_THROW_RUNTIME_ERROR_1("handler for type is already registered", rawType);
 
-		m_descriptors[rawType] = { handler, m_activeAllowedHosts };
+		m_descriptors[rawType] = { handler, m_activeAllowedHosts, std::make_shared<utils::LatencyHistogram>() };
 	}
 
 	const ServerPacketHandlers::PacketHandlerDescriptor* ServerPacketHandlers::findDescriptor(const Packet& packet) const {
@@ -21,6 +21,7 @@
 #pragma once
 #include "IoTypes.h"
 #include "PacketPayload.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
@@ -68,6 +69,9 @@ namespace catapult { namespace ionet {
 		/// Packet handler function.
 		using PacketHandler = consumer<const Packet&, ContextType&>;
 
+		/// Packet type and processing latency histogram pairs.
+		using HandlerLatencies = std::vector<std::pair<PacketType, std::shared_ptr<const utils::LatencyHistogram>>>;
+
 	public:
 		/// Creates packet handlers with a max packet data size (\a maxPacketDataSize).
 		explicit ServerPacketHandlers(uint32_t maxPacketDataSize = std::numeric_limits<uint32_t>::max());
@@ -89,6 +93,10 @@ namespace catapult { namespace ionet {
 		/// packet was processed.
 		bool process(const Packet& packet, ContextType& context) const;
 
+		/// Gets the processing latency histograms of all registered handlers.
+		/// \note Histograms are shared by all copies of these handlers.
+		HandlerLatencies handlerLatencies() const;
+
 	public:
 		/// Sets \a hosts that are allowed to access subsequently registered handlers.
 		void setAllowedHosts(const std::unordered_set<std::string>& hosts);
@@ -100,6 +108,7 @@ namespace catapult { namespace ionet {
 		struct PacketHandlerDescriptor {
 			PacketHandler Handler;
 			std::unordered_set<std::string> AllowedHosts;
+			std::shared_ptr<utils::LatencyHistogram> pLatency;
 		};
 
 	private:
@@ -139,6 +139,9 @@ namespace catapult { namespace ionet {
 	/* Block statement has been requested by a client. */ \
 	ENUM_VALUE(Block_Statement, 1103) \
 	\
+	/* Request for the current diagnostic latency histogram summaries. */ \
+	ENUM_VALUE(Diagnostic_Latencies, 1104) \
+	\
 	/* Account infos have been requested by a client. */ \
 	ENUM_VALUE(Account_Infos, FACILITY_BASED_CODE(1200, Core)) \
 	\
@@ -94,7 +94,7 @@ namespace catapult { namespace ionet {
 					const Key& remoteKey,
 					uint32_t maxSignedPacketDataSize)
 					: m_pIo(pIo)
-					, m_sourceKeyPair(sourceKeyPair)
+					, m_signer(sourceKeyPair)
 					, m_remoteKey(remoteKey)
 					, m_maxSignedPacketDataSize(maxSignedPacketDataSize)
 			{}
@@ -109,7 +109,7 @@ namespace catapult { namespace ionet {
 
 				auto payloadHash = CalculatePayloadHash(payload);
 				auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
-				crypto::Sign(m_sourceKeyPair, payloadHash, pSecurePacketHeader->Signature);
+				m_signer.sign(payloadHash, pSecurePacketHeader->Signature);
 
 				m_pIo->write(PacketPayload::Merge(pSecurePacketHeader, payload), callback);
 			}
@@ -122,7 +122,7 @@ namespace catapult { namespace ionet {
 
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
-			const crypto::KeyPair& m_sourceKeyPair;
+			crypto::Signer m_signer;
 			Key m_remoteKey;
 			uint32_t m_maxSignedPacketDataSize;
 		};
@@ -35,6 +35,8 @@
 #include "catapult/io/FileQueue.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/local/HostUtils.h"
+#include "catapult/model/PublicKeyToAddressCache.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace local {
@@ -101,6 +103,7 @@ namespace catapult { namespace local {
 
 				CATAPULT_LOG(debug) << "registering counters";
 				registerCounters();
+				registerLatencyHistograms();
 
 				utils::StackLogger stackLogger("booting local node", utils::LogLevel::Info);
 				auto isFirstBoot = executeAndNotifyNemesis();
@@ -120,12 +123,16 @@ namespace catapult { namespace local {
 						*m_pStateChangeSubscriber,
 						*m_pNodeSubscriber,
 						m_counters,
+						m_latencyHistograms,
 						m_pluginManager,
 						m_pBootstrapper->pool());
 				extensionManager.registerServices(m_serviceLocator, serviceState);
 				for (const auto& counter : m_serviceLocator.counters())
 					m_counters.push_back(counter);
 
+				for (const auto& latencyPair : serviceState.packetHandlers().handlerLatencies())
+					m_latencyHistograms.add("PACKET LAT", utils::to_underlying_type(latencyPair.first), latencyPair.second);
+
 				m_isBooted = true;
 
 				// save nemesis state on first boot so that state directory is created and NemesisBlockNotifier
@@ -146,6 +153,26 @@ namespace catapult { namespace local {
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+
+				auto& addressCache = model::GetPublicKeyToAddressCache(m_config.BlockChain.Network.Identifier);
+				m_counters.emplace_back(utils::DiagnosticCounterId("ADCACHE SIZE"), [&addressCache]() {
+					return addressCache.size();
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("ADCACHE HITS"), [&addressCache]() {
+					return addressCache.numHits();
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("ADCACHE MISS"), [&addressCache]() {
+					return addressCache.numMisses();
+				});
+			}
+
+			void registerLatencyHistograms() {
+				const auto& storageLatencies = m_storage.latencies();
+				m_latencyHistograms.add("BLKSTG LOAD", 0, storageLatencies.pLoad);
+				m_latencyHistograms.add("BLKSTG SAVE", 0, storageLatencies.pSave);
+				m_latencyHistograms.add("BLKSTG COMMIT", 0, storageLatencies.pCommit);
+
+				m_latencyHistograms.add("CACHE COMMIT", 0, m_catapultCache.commitLatency());
 			}
 
 			bool executeAndNotifyNemesis() {
@@ -247,6 +274,7 @@ namespace catapult { namespace local {
 
 			plugins::PluginManager& m_pluginManager;
 			std::vector<utils::DiagnosticCounter> m_counters;
+			utils::LatencyHistogramRegistry m_latencyHistograms;
 			bool m_isBooted;
 		};
 	}
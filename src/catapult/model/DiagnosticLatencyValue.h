@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stdint.h>
+
+namespace catapult { namespace model {
+
+#pragma pack(push, 1)
+
+	/// A diagnostic latency histogram summary (in microseconds).
+	struct DiagnosticLatencyValue {
+		/// Histogram id.
+		uint64_t Id;
+
+		/// Histogram index.
+		uint32_t Index;
+
+		/// Number of recorded values.
+		uint64_t Count;
+
+		/// Median value.
+		uint64_t Median;
+
+		/// 99th percentile value.
+		uint64_t Percentile99;
+
+		/// Maximum value.
+		uint64_t Max;
+	};
+
+#pragma pack(pop)
+}}
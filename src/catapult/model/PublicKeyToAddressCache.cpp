@@ -0,0 +1,136 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PublicKeyToAddressCache.h"
+#include "Address.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/utils/Hashers.h"
+#include <array>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace model {
+
+	namespace {
+		constexpr size_t Num_Shards = 16;
+	}
+
+	struct PublicKeyToAddressCache::Shard {
+	public:
+		using Entry = std::pair<Key, Address>;
+		using EntryList = std::list<Entry>;
+
+	public:
+		size_t MaxSize;
+		std::mutex Mutex;
+		EntryList Entries; // ordered from most recently used to least recently used
+		std::unordered_map<Key, EntryList::iterator, utils::ArrayHasher<Key>> EntryMap;
+	};
+
+	PublicKeyToAddressCache::PublicKeyToAddressCache(NetworkIdentifier networkIdentifier, size_t maxSize)
+			: m_networkIdentifier(networkIdentifier)
+			, m_pShards(std::make_unique<Shard[]>(Num_Shards))
+			, m_numHits(0)
+			, m_numMisses(0) {
+		// distribute remainder across first shards so that sum of all shard sizes is exactly maxSize
+		for (auto i = 0u; i < Num_Shards; ++i)
+			m_pShards[i].MaxSize = maxSize / Num_Shards + (i < maxSize % Num_Shards ? 1 : 0);
+	}
+
+	PublicKeyToAddressCache::~PublicKeyToAddressCache() = default;
+
+	NetworkIdentifier PublicKeyToAddressCache::networkIdentifier() const {
+		return m_networkIdentifier;
+	}
+
+	size_t PublicKeyToAddressCache::size() const {
+		size_t size = 0;
+		for (auto i = 0u; i < Num_Shards; ++i) {
+			std::lock_guard<std::mutex> guard(m_pShards[i].Mutex);
+			size += m_pShards[i].EntryMap.size();
+		}
+
+		return size;
+	}
+
+	uint64_t PublicKeyToAddressCache::numHits() const {
+		return m_numHits;
+	}
+
+	uint64_t PublicKeyToAddressCache::numMisses() const {
+		return m_numMisses;
+	}
+
+	Address PublicKeyToAddressCache::toAddress(const Key& publicKey) {
+		auto& shard = this->shard(publicKey);
+		{
+			std::lock_guard<std::mutex> guard(shard.Mutex);
+			auto iter = shard.EntryMap.find(publicKey);
+			if (shard.EntryMap.cend() != iter) {
+				shard.Entries.splice(shard.Entries.begin(), shard.Entries, iter->second);
+				++m_numHits;
+				return iter->second->second;
+			}
+		}
+
+		// calculate address outside of lock because it is relatively expensive
+		++m_numMisses;
+		auto address = PublicKeyToAddress(publicKey, m_networkIdentifier);
+		if (0 == shard.MaxSize)
+			return address;
+
+		std::lock_guard<std::mutex> guard(shard.Mutex);
+		if (shard.EntryMap.cend() != shard.EntryMap.find(publicKey))
+			return address;
+
+		if (shard.EntryMap.size() >= shard.MaxSize) {
+			shard.EntryMap.erase(shard.Entries.back().first);
+			shard.Entries.pop_back();
+		}
+
+		shard.Entries.emplace_front(publicKey, address);
+		shard.EntryMap.emplace(publicKey, shard.Entries.begin());
+		return address;
+	}
+
+	PublicKeyToAddressCache::Shard& PublicKeyToAddressCache::shard(const Key& publicKey) const {
+		// use a byte not consumed by ArrayHasher so that shard selection is independent of bucket selection
+		return m_pShards[publicKey[0] % Num_Shards];
+	}
+
+	PublicKeyToAddressCache& GetPublicKeyToAddressCache(NetworkIdentifier networkIdentifier) {
+		// there are only a handful of network identifiers, so lazily create a cache for each one when it is first used
+		constexpr auto Num_Network_Identifiers = 256u;
+		static std::array<std::once_flag, Num_Network_Identifiers> onceFlags;
+		static std::array<std::unique_ptr<PublicKeyToAddressCache>, Num_Network_Identifiers> caches;
+
+		auto index = utils::to_underlying_type(networkIdentifier);
+		std::call_once(onceFlags[index], [networkIdentifier, &pCache = caches[index]]() {
+			pCache = std::make_unique<PublicKeyToAddressCache>(networkIdentifier, PublicKeyToAddressCache::Default_Max_Size);
+		});
+
+		return *caches[index];
+	}
+
+	Address CachedPublicKeyToAddress(const Key& publicKey, NetworkIdentifier networkIdentifier) {
+		return GetPublicKeyToAddressCache(networkIdentifier).toAddress(publicKey);
+	}
+}}
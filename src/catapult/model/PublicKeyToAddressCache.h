@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NetworkInfo.h"
+#include "catapult/types.h"
+#include <atomic>
+#include <memory>
+
+namespace catapult { namespace model {
+
+	/// Bounded, thread safe cache of addresses derived from public keys for a single network.
+	/// \note Cache is partitioned into independently locked shards and each shard evicts its least recently used address.
+	class PublicKeyToAddressCache {
+	private:
+		struct Shard;
+
+	public:
+		/// Default maximum number of addresses held by a cache.
+		static constexpr size_t Default_Max_Size = 100'000;
+
+	public:
+		/// Creates a cache for the network identified by \a networkIdentifier that holds at most \a maxSize addresses.
+		PublicKeyToAddressCache(NetworkIdentifier networkIdentifier, size_t maxSize);
+
+		/// Destroys the cache.
+		~PublicKeyToAddressCache();
+
+	public:
+		/// Gets the network identifier.
+		NetworkIdentifier networkIdentifier() const;
+
+		/// Gets the number of cached addresses.
+		size_t size() const;
+
+		/// Gets the number of conversions that found a cached address.
+		uint64_t numHits() const;
+
+		/// Gets the number of conversions that calculated an address.
+		uint64_t numMisses() const;
+
+	public:
+		/// Converts \a publicKey to an address, calculating and caching it when it is not cached.
+		Address toAddress(const Key& publicKey);
+
+	private:
+		Shard& shard(const Key& publicKey) const;
+
+	private:
+		NetworkIdentifier m_networkIdentifier;
+		std::unique_ptr<Shard[]> m_pShards;
+		std::atomic<uint64_t> m_numHits;
+		std::atomic<uint64_t> m_numMisses;
+	};
+
+	/// Gets the process wide public key to address cache for the network identified by \a networkIdentifier.
+	PublicKeyToAddressCache& GetPublicKeyToAddressCache(NetworkIdentifier networkIdentifier);
+
+	/// Creates an address from a public key (\a publicKey) for the network identified by \a networkIdentifier
+	/// using the process wide cache for that network.
+	Address CachedPublicKeyToAddress(const Key& publicKey, NetworkIdentifier networkIdentifier);
+}}
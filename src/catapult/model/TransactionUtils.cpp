@@ -19,9 +19,9 @@
 **/
 
 #include "TransactionUtils.h"
-#include "Address.h"
 #include "NotificationPublisher.h"
 #include "NotificationSubscriber.h"
+#include "PublicKeyToAddressCache.h"
 #include "ResolverContext.h"
 #include "Transaction.h"
 
@@ -48,7 +48,7 @@ namespace catapult { namespace model {
 
 		private:
 			UnresolvedAddress toAddress(const Key& publicKey) const {
-				auto resolvedAddress = PublicKeyToAddress(publicKey, m_networkIdentifier);
+				auto resolvedAddress = CachedPublicKeyToAddress(publicKey, m_networkIdentifier);
 
 				UnresolvedAddress unresolvedAddress;
 				std::memcpy(unresolvedAddress.data(), resolvedAddress.data(), resolvedAddress.size());
@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "EpochReclaimer.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <thread>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr uint64_t Inactive_Slot_Epoch = 0;
+
+#pragma push_macro("Yield")
+#undef Yield
+		void Yield() {
+			std::this_thread::yield();
+		}
+#pragma pop_macro("Yield")
+	}
+
+	// region ReaderGuard
+
+	EpochReclaimer::ReaderGuard::ReaderGuard(std::atomic<uint64_t>& slot) : m_pSlot(&slot)
+	{}
+
+	EpochReclaimer::ReaderGuard::ReaderGuard(ReaderGuard&& rhs) : m_pSlot(rhs.m_pSlot) {
+		rhs.m_pSlot = nullptr;
+	}
+
+	EpochReclaimer::ReaderGuard::~ReaderGuard() {
+		if (m_pSlot)
+			m_pSlot->store(Inactive_Slot_Epoch);
+	}
+
+	// endregion
+
+	// region EpochReclaimer
+
+	EpochReclaimer::EpochReclaimer(size_t maxReaders)
+			: m_epoch(Inactive_Slot_Epoch + 1)
+			, m_numSlots(maxReaders)
+			, m_pSlots(std::make_unique<std::atomic<uint64_t>[]>(maxReaders)) {
+		for (auto i = 0u; i < m_numSlots; ++i)
+			m_pSlots[i] = Inactive_Slot_Epoch;
+	}
+
+	EpochReclaimer::~EpochReclaimer() {
+		for (auto& retiredObject : m_retiredObjects)
+			retiredObject.Deleter();
+	}
+
+	uint64_t EpochReclaimer::epoch() const {
+		return m_epoch;
+	}
+
+	size_t EpochReclaimer::numPending() const {
+		std::lock_guard<std::mutex> lock(m_retiredMutex);
+		return m_retiredObjects.size();
+	}
+
+	EpochReclaimer::ReaderGuard EpochReclaimer::enter() {
+		// start searching at a thread dependent slot in order to reduce contention between readers
+		auto startIndex = std::hash<std::thread::id>()(std::this_thread::get_id()) % m_numSlots;
+		for (;;) {
+			// the (sequentially consistent) slot update must be visible before any protected pointer is loaded by the reader
+			auto epoch = m_epoch.load();
+			for (auto i = 0u; i < m_numSlots; ++i) {
+				auto& slot = m_pSlots[(startIndex + i) % m_numSlots];
+				auto expected = Inactive_Slot_Epoch;
+				if (slot.compare_exchange_strong(expected, epoch))
+					return ReaderGuard(slot);
+			}
+
+			// all slots are in use, so wait for a reader to exit
+			Yield();
+		}
+	}
+
+	void EpochReclaimer::retire(action&& deleter) {
+		// any reader that entered before the epoch was advanced is tagged with an epoch no greater than the retire epoch
+		auto retireEpoch = m_epoch.fetch_add(1);
+
+		std::lock_guard<std::mutex> lock(m_retiredMutex);
+		m_retiredObjects.push_back(RetiredObject{ retireEpoch, std::move(deleter) });
+	}
+
+	void EpochReclaimer::synchronize() {
+		// any reader that entered before the epoch was advanced is tagged with an epoch no greater than the wait epoch
+		auto waitEpoch = m_epoch.fetch_add(1);
+		while (findMinActiveEpoch() <= waitEpoch)
+			Yield();
+	}
+
+	size_t EpochReclaimer::reclaim() {
+		std::vector<RetiredObject> reclaimableObjects;
+		{
+			std::lock_guard<std::mutex> lock(m_retiredMutex);
+			auto minActiveEpoch = findMinActiveEpoch();
+			auto iter = std::partition(m_retiredObjects.begin(), m_retiredObjects.end(), [minActiveEpoch](const auto& retiredObject) {
+				return retiredObject.Epoch >= minActiveEpoch;
+			});
+
+			std::move(iter, m_retiredObjects.end(), std::back_inserter(reclaimableObjects));
+			m_retiredObjects.erase(iter, m_retiredObjects.end());
+		}
+
+		// call deleters outside of the lock
+		for (auto& retiredObject : reclaimableObjects)
+			retiredObject.Deleter();
+
+		return reclaimableObjects.size();
+	}
+
+	uint64_t EpochReclaimer::findMinActiveEpoch() const {
+		auto minActiveEpoch = std::numeric_limits<uint64_t>::max();
+		for (auto i = 0u; i < m_numSlots; ++i) {
+			auto slotEpoch = m_pSlots[i].load();
+			if (Inactive_Slot_Epoch != slotEpoch)
+				minActiveEpoch = std::min(minActiveEpoch, slotEpoch);
+		}
+
+		return minActiveEpoch;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "catapult/functions.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Epoch based reclaimer that defers the destruction of retired objects until no reader can observe them anymore.
+	/// \note
+	/// - readers never wait for writers; they only register themselves in a free reader slot
+	/// - 256 max concurrent readers by default (additional readers yield until a slot is released)
+	class EpochReclaimer : public NonCopyable {
+	public:
+		/// Default maximum number of concurrent readers.
+		static constexpr size_t Default_Max_Readers = 256;
+
+	public:
+		/// A reader guard that marks a reader as active for its lifetime.
+		class ReaderGuard : public MoveOnly {
+		public:
+			/// Creates a guard around reader slot \a slot.
+			explicit ReaderGuard(std::atomic<uint64_t>& slot);
+
+			/// Move constructor.
+			ReaderGuard(ReaderGuard&& rhs);
+
+			/// Releases the reader slot.
+			~ReaderGuard();
+
+		private:
+			std::atomic<uint64_t>* m_pSlot;
+		};
+
+	public:
+		/// Creates a reclaimer that supports at most \a maxReaders concurrent readers.
+		explicit EpochReclaimer(size_t maxReaders = Default_Max_Readers);
+
+		/// Destroys the reclaimer and all objects that are still pending reclamation.
+		/// \note All readers must have exited before the reclaimer is destroyed.
+		~EpochReclaimer();
+
+	public:
+		/// Gets the current epoch.
+		uint64_t epoch() const;
+
+		/// Gets the number of retired objects that have not yet been reclaimed.
+		size_t numPending() const;
+
+	public:
+		/// Enters a read side critical section that lasts for the lifetime of the returned guard.
+		ReaderGuard enter();
+
+		/// Retires an object by scheduling its \a deleter to be called once all readers that could have observed it have exited.
+		/// \note The object must already be unreachable by new readers.
+		void retire(action&& deleter);
+
+		/// Blocks until all readers that entered before this call have exited.
+		/// \note This must not be called by a thread that is an active reader.
+		void synchronize();
+
+		/// Reclaims all retired objects that can no longer be observed by any reader and returns the number reclaimed.
+		size_t reclaim();
+
+	private:
+		uint64_t findMinActiveEpoch() const;
+
+	private:
+		struct RetiredObject {
+			uint64_t Epoch;
+			action Deleter;
+		};
+
+	private:
+		std::atomic<uint64_t> m_epoch;
+		size_t m_numSlots;
+		std::unique_ptr<std::atomic<uint64_t>[]> m_pSlots;
+
+		mutable std::mutex m_retiredMutex;
+		std::vector<RetiredObject> m_retiredObjects;
+	};
+}}
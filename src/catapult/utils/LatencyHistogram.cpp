@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include <cmath>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr size_t Num_Linear_Buckets = 16;
+		constexpr size_t Num_Sub_Bucket_Bits = 3;
+		constexpr size_t Num_Sub_Buckets = 1 << Num_Sub_Bucket_Bits;
+
+		size_t HighestBitIndex(uint64_t value) {
+			size_t index = 0;
+			while (value >>= 1)
+				++index;
+
+			return index;
+		}
+	}
+
+	LatencyHistogram::LatencyHistogram() : m_count(0), m_max(0) {
+		for (auto& bucket : m_buckets)
+			bucket = 0;
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count;
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max;
+	}
+
+	uint64_t LatencyHistogram::percentile(double percentile) const {
+		auto count = m_count.load();
+		if (0 == count)
+			return 0;
+
+		// buckets are updated independently of count, so stop at last bucket if concurrent records make them disagree
+		auto rank = static_cast<uint64_t>(std::ceil(static_cast<double>(count) * percentile / 100.0));
+		uint64_t numValues = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			numValues += m_buckets[i].load(std::memory_order_relaxed);
+			if (numValues >= rank && 0 != numValues)
+				return std::min(BucketUpperBound(i), m_max.load());
+		}
+
+		return m_max;
+	}
+
+	void LatencyHistogram::record(uint64_t value) {
+		m_buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		m_count.fetch_add(1, std::memory_order_relaxed);
+
+		auto max = m_max.load(std::memory_order_relaxed);
+		while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+		{}
+	}
+
+	size_t LatencyHistogram::BucketIndex(uint64_t value) {
+		if (value < Num_Linear_Buckets)
+			return static_cast<size_t>(value);
+
+		// value has at least five significant bits, so use the three bits following the highest one as the sub bucket
+		auto highestBitIndex = HighestBitIndex(value);
+		auto subBucket = (value >> (highestBitIndex - Num_Sub_Bucket_Bits)) & (Num_Sub_Buckets - 1);
+		return Num_Linear_Buckets + (highestBitIndex - 4) * Num_Sub_Buckets + static_cast<size_t>(subBucket);
+	}
+
+	uint64_t LatencyHistogram::BucketUpperBound(size_t index) {
+		if (index < Num_Linear_Buckets)
+			return index;
+
+		auto highestBitIndex = (index - Num_Linear_Buckets) / Num_Sub_Buckets + 4;
+		auto subBucket = (index - Num_Linear_Buckets) % Num_Sub_Buckets;
+		auto shift = highestBitIndex - Num_Sub_Bucket_Bits;
+		auto lowerBound = static_cast<uint64_t>(Num_Sub_Buckets + subBucket) << shift;
+		return lowerBound + ((static_cast<uint64_t>(1) << shift) - 1);
+	}
+}}
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "StackTimer.h"
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Histogram of latency values (in microseconds) with logarithmic buckets.
+	/// \note Values are recorded lock free and each bucket spans at most 1/8 of its lower bound,
+	///       so reported percentiles are accurate to within 12.5%.
+	class LatencyHistogram {
+	public:
+		/// Number of buckets.
+		static constexpr size_t Num_Buckets = 16 + (64 - 4) * 8;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the largest recorded value.
+		uint64_t max() const;
+
+		/// Gets the (upper bound of the) value below which \a percentile percent of all recorded values fall.
+		/// \note \c 0 is returned when no values have been recorded.
+		uint64_t percentile(double percentile) const;
+
+	public:
+		/// Records \a value.
+		void record(uint64_t value);
+
+	public:
+		/// Gets the index of the bucket containing \a value.
+		static size_t BucketIndex(uint64_t value);
+
+		/// Gets the largest value contained in the bucket with \a index.
+		static uint64_t BucketUpperBound(size_t index);
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_buckets;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_max;
+	};
+
+	/// Records the lifetime of a stack based latency recorder in a latency histogram.
+	class LatencyRecorder {
+	public:
+		/// Creates a recorder around \a histogram.
+		explicit LatencyRecorder(LatencyHistogram& histogram) : m_histogram(histogram)
+		{}
+
+		/// Records the elapsed time in the histogram.
+		~LatencyRecorder() {
+			m_histogram.record(m_timer.micros());
+		}
+
+	private:
+		LatencyHistogram& m_histogram;
+		StackTimer m_timer;
+	};
+}}
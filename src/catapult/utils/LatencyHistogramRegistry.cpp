@@ -0,0 +1,41 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogramRegistry.h"
+
+namespace catapult { namespace utils {
+
+	size_t LatencyHistogramRegistry::size() const {
+		SpinLockGuard guard(m_lock);
+		return m_entries.size();
+	}
+
+	std::vector<LatencyHistogramRegistry::Entry> LatencyHistogramRegistry::entries() const {
+		SpinLockGuard guard(m_lock);
+		return m_entries;
+	}
+
+	void LatencyHistogramRegistry::add(const std::string& name, uint32_t index, const std::shared_ptr<const LatencyHistogram>& pHistogram) {
+		Entry entry{ DiagnosticCounterId(name), index, pHistogram };
+
+		SpinLockGuard guard(m_lock);
+		m_entries.push_back(std::move(entry));
+	}
+}}
@@ -0,0 +1,60 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DiagnosticCounterId.h"
+#include "LatencyHistogram.h"
+#include "SpinLock.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Thread safe registry of named latency histograms.
+	class LatencyHistogramRegistry {
+	public:
+		/// A registered latency histogram.
+		struct Entry {
+			/// Histogram id.
+			DiagnosticCounterId Id;
+
+			/// Histogram index (e.g. consumer stage or packet type) distinguishing histograms with the same id.
+			uint32_t Index;
+
+			/// Histogram.
+			std::shared_ptr<const LatencyHistogram> pHistogram;
+		};
+
+	public:
+		/// Gets the number of registered histograms.
+		size_t size() const;
+
+		/// Gets a snapshot of all registered histograms.
+		std::vector<Entry> entries() const;
+
+	public:
+		/// Adds \a pHistogram with \a name and \a index to the registry.
+		void add(const std::string& name, uint32_t index, const std::shared_ptr<const LatencyHistogram>& pHistogram);
+
+	private:
+		std::vector<Entry> m_entries;
+		mutable SpinLock m_lock;
+	};
+}}
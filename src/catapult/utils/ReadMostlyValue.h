@@ -0,0 +1,143 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "EpochReclaimer.h"
+
+namespace catapult { namespace utils {
+
+	/// Read mostly value that gives readers lock free access to immutable versions of a value.
+	/// \note
+	/// - modifiers are serialized and modify a private copy that is published when the modifier is destroyed
+	/// - replaced versions are reclaimed by an epoch based reclaimer once no view can observe them
+	template<typename TValue>
+	class ReadMostlyValue : public NonCopyable {
+	public:
+		/// A read only view of a published version of the value.
+		class View : public MoveOnly {
+		public:
+			/// Creates a view around \a value with reader context \a readerGuard.
+			View(const TValue& value, EpochReclaimer::ReaderGuard&& readerGuard)
+					: m_pValue(&value)
+					, m_readerGuard(std::move(readerGuard))
+			{}
+
+		public:
+			/// Gets a const reference to the value.
+			const TValue& operator*() const {
+				return *m_pValue;
+			}
+
+			/// Gets a const pointer to the value.
+			const TValue* operator->() const {
+				return m_pValue;
+			}
+
+		private:
+			const TValue* m_pValue;
+			EpochReclaimer::ReaderGuard m_readerGuard;
+		};
+
+		/// A write only view of a private copy of the value that is published when the modifier is destroyed.
+		class Modifier : public MoveOnly {
+		public:
+			/// Creates a modifier around \a owner and \a pValue with lock context \a lock.
+			Modifier(ReadMostlyValue& owner, std::unique_ptr<TValue>&& pValue, std::unique_lock<std::mutex>&& lock)
+					: m_owner(owner)
+					, m_pValue(std::move(pValue))
+					, m_lock(std::move(lock))
+			{}
+
+			/// Default move constructor.
+			Modifier(Modifier&&) = default;
+
+			/// Publishes the modified value.
+			~Modifier() {
+				if (m_pValue)
+					m_owner.publish(std::move(m_pValue));
+			}
+
+		public:
+			/// Gets a reference to the value.
+			TValue& operator*() const {
+				return *m_pValue;
+			}
+
+			/// Gets a pointer to the value.
+			TValue* operator->() const {
+				return m_pValue.get();
+			}
+
+		private:
+			ReadMostlyValue& m_owner;
+			std::unique_ptr<TValue> m_pValue;
+			std::unique_lock<std::mutex> m_lock;
+		};
+
+	public:
+		/// Creates a value by forwarding \a args to the value constructor.
+		template<typename... TArgs>
+		explicit ReadMostlyValue(TArgs&&... args) : m_pValue(new TValue(std::forward<TArgs>(args)...))
+		{}
+
+		/// Destroys the value.
+		~ReadMostlyValue() {
+			delete m_pValue.load();
+		}
+
+	public:
+		/// Gets the number of replaced versions that have not yet been reclaimed.
+		size_t numPendingVersions() const {
+			return m_reclaimer.numPending();
+		}
+
+	public:
+		/// Gets a read only view of the most recently published version of the value.
+		View view() const {
+			auto readerGuard = m_reclaimer.enter();
+			return View(*m_pValue.load(), std::move(readerGuard));
+		}
+
+		/// Gets a write only view of the value.
+		Modifier modifier() {
+			std::unique_lock<std::mutex> lock(m_modifierMutex);
+			return Modifier(*this, std::make_unique<TValue>(*m_pValue.load()), std::move(lock));
+		}
+
+		/// Blocks until all views created before this call have been destroyed.
+		/// \note This must not be called by a thread that holds a view.
+		void synchronize() {
+			m_reclaimer.synchronize();
+			m_reclaimer.reclaim();
+		}
+
+	private:
+		void publish(std::unique_ptr<TValue>&& pValue) {
+			const auto* pOldValue = m_pValue.exchange(pValue.release());
+			m_reclaimer.retire([pOldValue]() { delete pOldValue; });
+			m_reclaimer.reclaim();
+		}
+
+	private:
+		mutable EpochReclaimer m_reclaimer;
+		std::mutex m_modifierMutex;
+		std::atomic<const TValue*> m_pValue;
+	};
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/cache/CacheChangesStorageAdapter.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
 #include "tests/catapult/cache/test/DeltasAwareCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
@@ -133,51 +134,123 @@ namespace catapult { namespace cache {
 
 			EXPECT_EQ(expectedBuffersSet, appliedBuffersSet);
 		}
+
+		void SeedRandomSubCacheChanges(test::ByteVectorCacheChanges& subCacheChanges) {
+			subCacheChanges.Added.push_back(test::GenerateRandomVector(21));
+			subCacheChanges.Removed.push_back(test::GenerateRandomVector(21));
+			subCacheChanges.Removed.push_back(test::GenerateRandomVector(14));
+			subCacheChanges.Removed.push_back(test::GenerateRandomVector(17));
+			subCacheChanges.Copied.push_back(test::GenerateRandomVector(21));
+			subCacheChanges.Copied.push_back(test::GenerateRandomVector(14));
+		}
+
+		CacheChanges CreateCacheChanges(const test::ByteVectorCacheChanges& subCacheChanges) {
+			// create cache changes around single sub cache
+			CacheChanges::MemoryCacheChangesContainer cacheChangesContainer;
+			cacheChangesContainer.emplace_back(test::CopyByteVectorCacheChanges(subCacheChanges));
+			return CacheChanges(std::move(cacheChangesContainer));
+		}
+
+		void AssertAppliedChanges(
+				const test::ByteVectorCacheChanges& subCacheChanges,
+				const test::BasicDeltasAwareCache::Breadcrumbs& breadcrumbs) {
+			ASSERT_EQ(6u, breadcrumbs.size());
+
+			// - check added and copied (breadcrumbs in [0, 2] should be added and copied)
+			{
+				std::set<std::vector<uint8_t>> expectedBuffersSet(subCacheChanges.Added.cbegin(), subCacheChanges.Added.cend());
+				expectedBuffersSet.insert(subCacheChanges.Copied.cbegin(), subCacheChanges.Copied.cend());
+				AssertApplied(expectedBuffersSet, breadcrumbs, 0, 2, {
+					test::BasicDeltasAwareCache::OperationType::Purge,
+					test::BasicDeltasAwareCache::OperationType::Load_Into
+				});
+			}
+
+			// - check removed (breadcrumbs in [3, 5] should be removed)
+			{
+				std::set<std::vector<uint8_t>> expectedBuffersSet(subCacheChanges.Removed.cbegin(), subCacheChanges.Removed.cend());
+				AssertApplied(expectedBuffersSet, breadcrumbs, 3, 5, { test::BasicDeltasAwareCache::OperationType::Purge });
+			}
+		}
 	}
 
 	TEST(TEST_CLASS, CanApplyTypedChanges) {
 		// Arrange: seed random data
 		test::ByteVectorCacheChanges subCacheChanges;
-		subCacheChanges.Added.push_back(test::GenerateRandomVector(21));
-		subCacheChanges.Removed.push_back(test::GenerateRandomVector(21));
-		subCacheChanges.Removed.push_back(test::GenerateRandomVector(14));
-		subCacheChanges.Removed.push_back(test::GenerateRandomVector(17));
-		subCacheChanges.Copied.push_back(test::GenerateRandomVector(21));
-		subCacheChanges.Copied.push_back(test::GenerateRandomVector(14));
-
-		// - create cache changes around single sub cache
-		CacheChanges::MemoryCacheChangesContainer cacheChangesContainer;
-		cacheChangesContainer.emplace_back(test::CopyByteVectorCacheChanges(subCacheChanges));
-		CacheChanges cacheChanges(std::move(cacheChangesContainer));
-
-		// Act:
-		std::vector<uint8_t> buffer;
-		mocks::MockMemoryStream outputStream(buffer);
+		SeedRandomSubCacheChanges(subCacheChanges);
+		auto cacheChanges = CreateCacheChanges(subCacheChanges);
 
 		test::BasicDeltasAwareCache::Breadcrumbs breadcrumbs;
 		test::ByteVectorCacheDeltas deltas;
 		test::DeltasAwareCache<0> cache(deltas, breadcrumbs);
 		StorageAdapter adapter(cache);
+
+		// Act:
 		adapter.apply(cacheChanges);
 
 		// Assert:
-		ASSERT_EQ(6u, breadcrumbs.size());
-
-		// - check added and copied (breadcrumbs in [0, 2] should be added and copied)
-		{
-			std::set<std::vector<uint8_t>> expectedBuffersSet(subCacheChanges.Added.cbegin(), subCacheChanges.Added.cend());
-			expectedBuffersSet.insert(subCacheChanges.Copied.cbegin(), subCacheChanges.Copied.cend());
-			AssertApplied(expectedBuffersSet, breadcrumbs, 0, 2, {
-				test::BasicDeltasAwareCache::OperationType::Purge,
-				test::BasicDeltasAwareCache::OperationType::Load_Into
-			});
-		}
+		AssertAppliedChanges(subCacheChanges, breadcrumbs);
+	}
 
-		// - check removed (breadcrumbs in [3, 5] should be removed)
-		{
-			std::set<std::vector<uint8_t>> expectedBuffersSet(subCacheChanges.Removed.cbegin(), subCacheChanges.Removed.cend());
-			AssertApplied(expectedBuffersSet, breadcrumbs, 3, 5, { test::BasicDeltasAwareCache::OperationType::Purge });
-		}
+	TEST(TEST_CLASS, CanApplyTypedChangesToCacheDelta) {
+		// Arrange: seed random data
+		test::ByteVectorCacheChanges subCacheChanges;
+		SeedRandomSubCacheChanges(subCacheChanges);
+		auto cacheChanges = CreateCacheChanges(subCacheChanges);
+
+		test::BasicDeltasAwareCache::Breadcrumbs breadcrumbs;
+		test::ByteVectorCacheDeltas deltas;
+		CatapultCacheBuilder builder;
+		auto pSubCache = std::make_unique<test::DeltasAwareCache<0>>(deltas, breadcrumbs);
+		StorageAdapter adapter(*pSubCache);
+		builder.add<test::DeltasAwareCacheStorageTraits>(std::move(pSubCache));
+		auto cache = builder.build();
+		auto cacheDelta = cache.createDelta();
+
+		// Act:
+		adapter.apply(cacheChanges, cacheDelta);
+
+		// Assert:
+		AssertAppliedChanges(subCacheChanges, breadcrumbs);
+	}
+
+	// endregion
+
+	// region createUndoChanges
+
+	TEST(TEST_CLASS, CanCreateUndoChanges) {
+		// Arrange: seed three original elements, remove one, modify one and add one
+		//          (5 is a temporarily added element that has no original value)
+		auto original1 = test::GenerateRandomVector(21);
+		auto original2 = test::GenerateRandomVector(14);
+		auto original3 = test::GenerateRandomVector(17);
+		auto added = test::GenerateRandomVector(12);
+
+		test::ByteVectorCacheDeltas deltas;
+		deltas.Original.emplace(1, original1);
+		deltas.Original.emplace(2, original2);
+		deltas.Original.emplace(3, original3);
+		deltas.Added.emplace(4, added);
+		deltas.Copied.emplace(1, test::GenerateRandomVector(21));
+		deltas.Removed.emplace(2, original2);
+		deltas.Removed.emplace(5, test::GenerateRandomVector(11));
+
+		CatapultCacheBuilder builder;
+		auto pSubCache = std::make_unique<test::DeltasAwareCache<0>>(deltas);
+		StorageAdapter adapter(*pSubCache);
+		builder.add<test::DeltasAwareCacheStorageTraits>(std::move(pSubCache));
+		auto cache = builder.build();
+		auto cacheDelta = cache.createDelta();
+
+		// Act:
+		auto pChangesVoid = adapter.createUndoChanges(cacheDelta);
+		const auto& changes = static_cast<const test::ByteVectorCacheChanges&>(*pChangesVoid);
+
+		// Assert: original values are restored and added values are purged
+		using BufferSet = std::set<std::vector<uint8_t>>;
+		EXPECT_EQ(BufferSet({ original1, original2 }), BufferSet(changes.Added.cbegin(), changes.Added.cend()));
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>({ added }), changes.Removed);
+		EXPECT_TRUE(changes.Copied.empty());
 	}
 
 	// endregion
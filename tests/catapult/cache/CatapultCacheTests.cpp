@@ -24,6 +24,7 @@
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
@@ -370,6 +371,31 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(Height(123), cache.createDetachableDelta().height());
 	}
 
+	TEST(TEST_CLASS, CommitLatencyIsInitiallyEmpty) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		auto pLatency = cache.commitLatency();
+
+		// Assert:
+		EXPECT_EQ(0u, pLatency->count());
+	}
+
+	TEST(TEST_CLASS, CommitRecordsCommitLatency) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		for (auto i = 1u; i <= 3; ++i) {
+			auto delta = cache.createDelta();
+			cache.commit(Height(i));
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, cache.commitLatency()->count());
+	}
+
 	// endregion
 
 	// region dependent state
@@ -142,6 +142,10 @@ namespace catapult { namespace cache {
 				return m_delta->removedElements();
 			}
 
+			auto originalElements() const {
+				return m_delta->originalElements();
+			}
+
 			auto asReadOnly() const {
 				return m_delta->asReadOnly();
 			}
@@ -706,6 +706,94 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region snapshots
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesMadeAfterViewIsCreated) {
+		// Arrange:
+		auto pCache = test::CreateSeededMemoryUtCache(5);
+		auto view = pCache->view();
+
+		// Act:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		test::AddAll(*pCache, transactionInfos);
+		test::RemoveAll(*pCache, ExtractEverySecondHash(*pCache));
+
+		// Assert: view still contains original transactions
+		EXPECT_EQ(5u, view.size());
+		EXPECT_EQ(5u, test::ExtractTransactionInfos(view, 10).size());
+		test::AssertContainsNone(view, test::ExtractHashes(transactionInfos));
+
+		// - new view contains modified transactions
+		EXPECT_EQ(4u, pCache->view().size());
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesOfActiveModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+
+		// Act:
+		auto modifier = cache.modifier();
+		for (const auto& transactionInfo : transactionInfos)
+			modifier.add(transactionInfo);
+
+		auto view = cache.view();
+
+		// Assert:
+		EXPECT_EQ(3u, modifier.size());
+		EXPECT_EQ(0u, view.size());
+		test::AssertContainsNone(view, test::ExtractHashes(transactionInfos));
+	}
+
+	TEST(TEST_CLASS, ViewSeesChangesAfterModifierIsDestroyed) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			for (const auto& transactionInfo : transactionInfos)
+				modifier.add(transactionInfo);
+		}
+
+		auto view = cache.view();
+
+		// Assert:
+		EXPECT_EQ(3u, view.size());
+		test::AssertContainsAll(view, test::ExtractHashes(transactionInfos));
+	}
+
+	TEST(TEST_CLASS, SnapshotsAreIndependentAcrossManyTransactions) {
+		// Arrange: add enough transactions to span multiple internal chunks
+		auto pCache = test::CreateSeededMemoryUtCache(1000);
+		auto originalDeadlines = test::ExtractRawDeadlines(*pCache);
+		auto view1 = pCache->view();
+
+		// Act: remove some transactions from the middle and add some new ones
+		auto hashes = ExtractEverySecondHash(*pCache);
+		test::RemoveAll(*pCache, std::vector<Hash256>(hashes.cbegin() + 100, hashes.cbegin() + 300));
+		test::AddAll(*pCache, test::CreateTransactionInfos(10));
+		auto view2 = pCache->view();
+
+		// Assert:
+		EXPECT_EQ(1000u, view1.size());
+		EXPECT_EQ(810u, view2.size());
+		test::AssertContainsAll(view1, hashes);
+		test::AssertContainsAll(view2, std::vector<Hash256>(hashes.cbegin(), hashes.cbegin() + 100));
+		test::AssertContainsNone(view2, std::vector<Hash256>(hashes.cbegin() + 100, hashes.cbegin() + 300));
+		test::AssertContainsAll(view2, std::vector<Hash256>(hashes.cbegin() + 300, hashes.cend()));
+
+		std::vector<Timestamp::ValueType> view1Deadlines;
+		view1.forEach([&view1Deadlines](const auto& transactionInfo) {
+			view1Deadlines.push_back(transactionInfo.pEntity->Deadline.unwrap());
+			return true;
+		});
+		EXPECT_EQ(originalDeadlines, view1Deadlines);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -714,7 +802,7 @@ namespace catapult { namespace cache {
 		}
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(MemoryUtCacheTests)
+	DEFINE_SNAPSHOT_PROVIDER_TESTS(MemoryUtCacheTests)
 
 	// endregion
 }}
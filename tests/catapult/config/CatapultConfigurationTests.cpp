@@ -131,6 +131,7 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
+			EXPECT_EQ(50'000u, config.PublicKeyPointCacheMaxSize);
 
 			EXPECT_TRUE(config.TrustedHosts.empty());
 
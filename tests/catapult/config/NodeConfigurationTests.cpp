@@ -76,6 +76,7 @@ namespace catapult { namespace config {
 
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
 							{ "maxTrackedNodes", "222" },
+							{ "publicKeyPointCacheMaxSize", "3'456" },
 
 							{ "trustedHosts", "foo,BAR" }
 						}
@@ -160,6 +161,7 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
+				EXPECT_EQ(0u, config.PublicKeyPointCacheMaxSize);
 
 				EXPECT_TRUE(config.TrustedHosts.empty());
 
@@ -225,6 +227,7 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
+				EXPECT_EQ(3'456u, config.PublicKeyPointCacheMaxSize);
 
 				EXPECT_EQ(std::unordered_set<std::string>({ "foo", "BAR" }), config.TrustedHosts);
 
@@ -20,6 +20,7 @@
 
 #include "catapult/consumers/BlockConsumers.h"
 #include "catapult/consumers/TransactionConsumers.h"
+#include "catapult/crypto/PublicKeyPointCache.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/model/TransactionStatus.h"
@@ -164,13 +165,20 @@ namespace catapult { namespace consumers {
 								descriptors,
 								alwaysVerifiableIndexes))
 						, pPool(test::CreateStartedIoThreadPool())
-						, Consumer(CreateBlockBatchSignatureConsumer(GenerationHash, pPublisher, pPool, requiresValidationPredicate))
+						, pPointCache(std::make_shared<crypto::PublicKeyPointCache>(1000))
+						, Consumer(CreateBlockBatchSignatureConsumer(
+								GenerationHash,
+								pPublisher,
+								pPool,
+								pPointCache,
+								requiresValidationPredicate))
 				{}
 
 			public:
 				catapult::GenerationHash GenerationHash;
 				std::shared_ptr<MockSignatureNotificationPublisher> pPublisher;
 				std::shared_ptr<thread::IoThreadPool> pPool;
+				std::shared_ptr<crypto::PublicKeyPointCache> pPointCache;
 
 				disruptor::ConstBlockConsumer Consumer;
 			};
@@ -270,7 +278,8 @@ namespace catapult { namespace consumers {
 								descriptors,
 								alwaysVerifiableIndexes))
 						, pPool(test::CreateStartedIoThreadPool())
-						, Consumer(CreateTransactionBatchSignatureConsumer(GenerationHash, pPublisher, pPool, [this](
+						, pPointCache(std::make_shared<crypto::PublicKeyPointCache>(1000))
+						, Consumer(CreateTransactionBatchSignatureConsumer(GenerationHash, pPublisher, pPool, pPointCache, [this](
 								const auto& transaction,
 								const auto& hash,
 								auto result) {
@@ -283,6 +292,7 @@ namespace catapult { namespace consumers {
 				catapult::GenerationHash GenerationHash;
 				std::shared_ptr<MockSignatureNotificationPublisher> pPublisher;
 				std::shared_ptr<thread::IoThreadPool> pPool;
+				std::shared_ptr<crypto::PublicKeyPointCache> pPointCache;
 
 				std::vector<model::TransactionStatus> FailedTransactionStatuses;
 				disruptor::TransactionConsumer Consumer;
@@ -470,6 +480,28 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region all - point cache
+
+	ALL_TEST(DecompressedSignerPublicKeysAreCached) {
+		// Arrange: each entity has 7 signature notifications
+		auto elements = TTraits::CreateMultipleEntityElements();
+		auto descriptor = NotificationDescriptor::Signature | NotificationDescriptor::Verifiable;
+		typename TTraits::TestContext context(std::vector<NotificationDescriptor>(7, descriptor));
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert: all (random) signers were decompressed once and cached
+		test::AssertContinued(result);
+
+		auto numExpectedSigners = 7 * context.pPublisher->entityInfos().size();
+		EXPECT_EQ(numExpectedSigners, context.pPointCache->size());
+		EXPECT_EQ(0u, context.pPointCache->numHits());
+		EXPECT_EQ(numExpectedSigners, context.pPointCache->numMisses());
+	}
+
+	// endregion
+
 	// region block only
 
 	TEST(BLOCK_TEST_CLASS, CanProcessEntitiesWithSignatureNotifications_AllVerifiable_Mixed_NotAllRequired) {
@@ -152,6 +152,52 @@ namespace catapult { namespace consumers {
 
 		// endregion
 
+		// region MockFastUndo
+
+		struct FastUndoParams {
+		public:
+			FastUndoParams(const cache::CatapultCacheDelta& cacheDelta, Height commonHeight)
+					: IsPassedMarkedCache(test::IsMarkedCache(cacheDelta))
+					, CommonHeight(commonHeight)
+			{}
+
+		public:
+			const bool IsPassedMarkedCache;
+			const Height CommonHeight;
+		};
+
+		class MockFastUndo : public test::ParamsCapture<FastUndoParams> {
+		public:
+			MockFastUndo() : m_numUndoneBlocks(0)
+			{}
+
+		public:
+			bool operator()(cache::CatapultCacheDelta& cacheDelta, Height commonHeight) const {
+				const_cast<MockFastUndo*>(this)->push(cacheDelta, commonHeight);
+				if (0 == m_numUndoneBlocks)
+					return false;
+
+				// simulate undoing all blocks by modifying the state to mark it (like MockUndoBlock)
+				auto& blockStatisticCache = cacheDelta.sub<cache::BlockStatisticCache>();
+				for (auto i = 0u; i < m_numUndoneBlocks; ++i)
+					blockStatisticCache.insert(state::BlockStatistic(Height(blockStatisticCache.size() + 1)));
+
+				auto& height = cacheDelta.dependentState().LastRecalculationHeight;
+				height = AddImportanceHeight(height, m_numUndoneBlocks);
+				return true;
+			}
+
+		public:
+			void setSuccess(uint32_t numUndoneBlocks) {
+				m_numUndoneBlocks = numUndoneBlocks;
+			}
+
+		private:
+			uint32_t m_numUndoneBlocks;
+		};
+
+		// endregion
+
 		// region MockProcessor
 
 		struct ProcessorParams {
@@ -272,6 +318,31 @@ namespace catapult { namespace consumers {
 
 		// endregion
 
+		// region MockPreCommit
+
+		struct PreCommitParams {
+		public:
+			PreCommitParams(const cache::CatapultCacheDelta& cacheDelta, Height commonHeight, Height newHeight)
+					: IsPassedProcessedCache(cacheDelta.sub<cache::AccountStateCache>().contains(Sentinel_Processor_Public_Key))
+					, CommonHeight(commonHeight)
+					, NewHeight(newHeight)
+			{}
+
+		public:
+			const bool IsPassedProcessedCache;
+			const Height CommonHeight;
+			const Height NewHeight;
+		};
+
+		class MockPreCommit : public test::ParamsCapture<PreCommitParams> {
+		public:
+			void operator()(const cache::CatapultCacheDelta& cacheDelta, Height commonHeight, Height newHeight) const {
+				const_cast<MockPreCommit*>(this)->push(cacheDelta, commonHeight, newHeight);
+			}
+		};
+
+		// endregion
+
 		// region MockTransactionsChange
 
 		struct TransactionsChangeParams {
@@ -381,6 +452,9 @@ namespace catapult { namespace consumers {
 				handlers.UndoBlock = [this](const auto& block, auto& state, auto undoBlockType) {
 					return UndoBlock(block, state, undoBlockType);
 				};
+				handlers.FastUndo = [this](auto& cacheDelta, auto commonHeight) {
+					return FastUndo(cacheDelta, commonHeight);
+				};
 				handlers.Processor = [this](const auto& parentBlockInfo, auto& elements, auto& state) {
 					return Processor(parentBlockInfo, elements, state);
 				};
@@ -390,6 +464,9 @@ namespace catapult { namespace consumers {
 				handlers.PreStateWritten = [this](const auto& cacheDelta, auto height) {
 					return PreStateWritten(cacheDelta, height);
 				};
+				handlers.PreCommit = [this](const auto& cacheDelta, auto commonHeight, auto newHeight) {
+					return PreCommit(cacheDelta, commonHeight, newHeight);
+				};
 				handlers.TransactionsChange = [this](const auto& changeInfo) {
 					return TransactionsChange(changeInfo);
 				};
@@ -407,9 +484,11 @@ namespace catapult { namespace consumers {
 
 			MockDifficultyChecker DifficultyChecker;
 			MockUndoBlock UndoBlock;
+			MockFastUndo FastUndo;
 			MockProcessor Processor;
 			MockStateChange StateChange;
 			MockPreStateWritten PreStateWritten;
+			MockPreCommit PreCommit;
 			MockTransactionsChange TransactionsChange;
 			MockCommitStep CommitStep;
 
@@ -502,6 +581,7 @@ namespace catapult { namespace consumers {
 				// - no state changes were announced
 				EXPECT_EQ(0u, StateChange.params().size());
 				EXPECT_EQ(0u, PreStateWritten.params().size());
+				EXPECT_EQ(0u, PreCommit.params().size());
 
 				// - the state was not changed
 				EXPECT_EQ(Initial_Last_Recalculation_Height, Cache.createView().dependentState().LastRecalculationHeight);
@@ -551,6 +631,13 @@ namespace catapult { namespace consumers {
 				EXPECT_EQ(Modified_Last_Recalculation_Height, preStateWrittenParams.LastRecalculationHeight);
 				EXPECT_EQ(chainHeight, preStateWrittenParams.Height);
 
+				// - pre commit was announced
+				ASSERT_EQ(1u, PreCommit.params().size());
+				const auto& preCommitParams = PreCommit.params()[0];
+				EXPECT_TRUE(preCommitParams.IsPassedProcessedCache);
+				EXPECT_EQ(inputHeight - Height(1), preCommitParams.CommonHeight);
+				EXPECT_EQ(chainHeight, preCommitParams.NewHeight);
+
 				// - the state was actually changed
 				EXPECT_EQ(Modified_Last_Recalculation_Height, Cache.createView().dependentState().LastRecalculationHeight);
 
@@ -806,6 +893,7 @@ namespace catapult { namespace consumers {
 		// Assert:
 		test::AssertContinued(result);
 		EXPECT_EQ(0u, context.UndoBlock.params().size());
+		EXPECT_EQ(0u, context.FastUndo.params().size());
 		context.assertDifficultyCheckerInvocation(input);
 		context.assertProcessorInvocation(input);
 		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
@@ -829,6 +917,56 @@ namespace catapult { namespace consumers {
 		context.assertStored(input, model::ChainScore(Base_Difficulty - 1));
 	}
 
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsWithFastUndo) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
+		ConsumerTestContext context;
+		context.seedStorage(Height(7));
+		context.FastUndo.setSuccess(3);
+		auto input = CreateInput(Height(5), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+		context.assertDifficultyCheckerInvocation(input);
+
+		// - all blocks were undone at once
+		ASSERT_EQ(1u, context.FastUndo.params().size());
+		EXPECT_TRUE(context.FastUndo.params()[0].IsPassedMarkedCache);
+		EXPECT_EQ(Height(4), context.FastUndo.params()[0].CommonHeight);
+
+		// - only the common block was undone individually
+		ASSERT_EQ(1u, context.UndoBlock.params().size());
+		const auto& undoBlockParams = context.UndoBlock.params()[0];
+		EXPECT_EQ(*context.OriginalBlocks[2], *undoBlockParams.pBlock);
+		EXPECT_EQ(UndoBlockType::Common, undoBlockParams.UndoBlockType);
+		EXPECT_EQ(AddImportanceHeight(Initial_Last_Recalculation_Height, 3), undoBlockParams.LastRecalculationHeight);
+		EXPECT_EQ(3u, undoBlockParams.NumStatistics);
+
+		context.assertProcessorInvocation(input, 3);
+		context.assertStored(input, model::ChainScore(Base_Difficulty - 1));
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsWhenFastUndoFails) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
+		ConsumerTestContext context;
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(5), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: all blocks were undone individually
+		test::AssertContinued(result);
+		ASSERT_EQ(1u, context.FastUndo.params().size());
+		EXPECT_EQ(Height(4), context.FastUndo.params()[0].CommonHeight);
+
+		context.assertUnwind({ Height(7), Height(6), Height(5), Height(4) });
+		context.assertProcessorInvocation(input, 3);
+		context.assertStored(input, model::ChainScore(Base_Difficulty - 1));
+	}
+
 	TEST(TEST_CLASS, CanSyncIncompatibleChainsWithOnlyLastBlockDifferent) {
 		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 7-10
 		ConsumerTestContext context;
@@ -28,6 +28,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
@@ -47,6 +48,16 @@ namespace catapult { namespace consumers {
 			return utils::ParseByteArray<GenerationHash>("CE076EF4ABFBC65B046987429E274EC31506D173E91BF102F16BEB7FB8176230");
 		}
 
+		disruptor::BlockConsumer CreateBlockConsumer(const GenerationHash& generationHash, const model::TransactionRegistry& registry) {
+			return CreateBlockHashCalculatorConsumer(generationHash, registry, test::CreateStartedIoThreadPool());
+		}
+
+		disruptor::TransactionConsumer CreateTransactionConsumer(
+				const GenerationHash& generationHash,
+				const model::TransactionRegistry& registry) {
+			return CreateTransactionHashCalculatorConsumer(generationHash, registry, test::CreateStartedIoThreadPool());
+		}
+
 		struct CustomBuffersTraits {
 			static model::TransactionRegistry CreateTransactionRegistry() {
 				auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
@@ -152,7 +163,7 @@ namespace catapult { namespace consumers {
 			auto& blockElements = input.blocks();
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(blockElements);
+			auto result = CreateBlockConsumer(GetNetworkGenerationHash(), registry)(blockElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -164,7 +175,7 @@ namespace catapult { namespace consumers {
 
 	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
 		auto registry = mocks::CreateDefaultTransactionRegistry();
-		test::AssertPassthroughForEmptyInput(CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry));
+		test::AssertPassthroughForEmptyInput(CreateBlockConsumer(GetNetworkGenerationHash(), registry));
 	}
 
 	TEST(BLOCK_TEST_CLASS, CanProcessSingleEntity) {
@@ -183,6 +194,11 @@ namespace catapult { namespace consumers {
 		AssertBlockHashesAreCalculatedCorrectly(3, 4);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessManyEntitiesWithTransactions) {
+		// Assert: process more blocks and transactions than pool threads
+		AssertBlockHashesAreCalculatedCorrectly(50, 7);
+	}
+
 	TEST(BLOCK_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto generationHash = utils::ParseByteArray<GenerationHash>(test::Deterministic_Network_Generation_Hash_String);
@@ -193,7 +209,7 @@ namespace catapult { namespace consumers {
 		auto& blockElements = input.blocks();
 
 		// Act:
-		auto result = CreateBlockHashCalculatorConsumer(generationHash, registry)(blockElements);
+		auto result = CreateBlockConsumer(generationHash, registry)(blockElements);
 
 		// Assert:
 		test::AssertContinued(result);
@@ -211,7 +227,7 @@ namespace catapult { namespace consumers {
 		const_cast<mocks::MockTransaction*>(pTransaction)->Size = 2 * sizeof(mocks::MockTransaction) + 1;
 
 		// Act + Assert: transaction iteration throws an exception
-		EXPECT_THROW(CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(blockElements), catapult_runtime_error);
+		EXPECT_THROW(CreateBlockConsumer(GetNetworkGenerationHash(), registry)(blockElements), catapult_runtime_error);
 	}
 
 	// endregion
@@ -230,7 +246,7 @@ namespace catapult { namespace consumers {
 			const_cast<model::Block&>(blockElements[mismatchedIndex].Block).TransactionsHash[0] ^= 0xFF;
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(blockElements);
+			auto result = CreateBlockConsumer(GetNetworkGenerationHash(), registry)(blockElements);
 
 			// Assert: the elements were skipped because a block transactions hash didn't match
 			test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch);
@@ -245,6 +261,7 @@ namespace catapult { namespace consumers {
 	TEST(BLOCK_TEST_CLASS, MultipleEntitiesAreSkippedWhenAnyBlockTransactionsHashDoesNotMatch) {
 		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(3, 0, 1);
 		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(3, 4, 1);
+		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(50, 7, 42);
 	}
 
 	// endregion
@@ -274,7 +291,7 @@ namespace catapult { namespace consumers {
 			auto& transactionElements = input.transactions();
 
 			// Act:
-			auto result = CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(transactionElements);
+			auto result = CreateTransactionConsumer(GetNetworkGenerationHash(), registry)(transactionElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -286,7 +303,7 @@ namespace catapult { namespace consumers {
 
 	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
 		auto registry = mocks::CreateDefaultTransactionRegistry();
-		test::AssertPassthroughForEmptyInput(CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHash(), registry));
+		test::AssertPassthroughForEmptyInput(CreateTransactionConsumer(GetNetworkGenerationHash(), registry));
 	}
 
 	TEST(TRANSACTION_TEST_CLASS, CanProcessSingleEntity) {
@@ -297,6 +314,11 @@ namespace catapult { namespace consumers {
 		AssertTransactionHashesAreCalculatedCorrectly(3);
 	}
 
+	TEST(TRANSACTION_TEST_CLASS, CanProcessManyEntities) {
+		// Assert: process more transactions than pool threads
+		AssertTransactionHashesAreCalculatedCorrectly(100);
+	}
+
 	TEST(TRANSACTION_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto generationHash = utils::ParseByteArray<GenerationHash>(test::Deterministic_Network_Generation_Hash_String);
@@ -307,7 +329,7 @@ namespace catapult { namespace consumers {
 		auto& transactionElements = input.transactions();
 
 		// Act:
-		auto result = CreateTransactionHashCalculatorConsumer(generationHash, registry)(transactionElements);
+		auto result = CreateTransactionConsumer(generationHash, registry)(transactionElements);
 
 		// Assert:
 		test::AssertContinued(result);
@@ -331,7 +353,7 @@ namespace catapult { namespace consumers {
 				}
 
 				static auto Consume(const model::TransactionRegistry& registry, ConsumerInput& input) {
-					return CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(input.blocks());
+					return CreateBlockConsumer(GetNetworkGenerationHash(), registry)(input.blocks());
 				}
 
 				static const auto& GetTransaction(const ConsumerInput& input) {
@@ -352,7 +374,7 @@ namespace catapult { namespace consumers {
 				{}
 
 				static auto Consume(const model::TransactionRegistry& registry, ConsumerInput& input) {
-					return CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHash(), registry)(input.transactions());
+					return CreateTransactionConsumer(GetNetworkGenerationHash(), registry)(input.transactions());
 				}
 
 				static const auto& GetTransaction(const ConsumerInput& input) {
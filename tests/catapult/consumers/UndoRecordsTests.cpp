@@ -0,0 +1,293 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/UndoRecords.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <array>
+
+namespace catapult { namespace consumers {
+
+#define TEST_CLASS UndoRecordsTests
+
+	namespace {
+		constexpr auto Test_Mosaic_Id = MosaicId(1234);
+		constexpr uint32_t Max_Rollback_Blocks = 10;
+
+		// region test utils
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_cache(test::CreateEmptyCatapultCache())
+					, m_records(m_cache, Max_Rollback_Blocks) {
+				// seed the cache with two accounts at height 1
+				commit(Height(0), Height(1), [this](auto& cacheDelta) {
+					setBalance(cacheDelta, Account1, Amount(100));
+					setBalance(cacheDelta, Account2, Amount(200));
+					cacheDelta.dependentState().NumTotalTransactions = 1;
+				});
+
+				// Sanity: seeding is captured like any other chain extension
+				EXPECT_EQ(1u, m_records.size());
+			}
+
+		public:
+			const Address Account1 = test::GenerateRandomByteArray<Address>();
+			const Address Account2 = test::GenerateRandomByteArray<Address>();
+			const Address Account3 = test::GenerateRandomByteArray<Address>();
+
+		public:
+			auto& cache() {
+				return m_cache;
+			}
+
+			auto& records() {
+				return m_records;
+			}
+
+		public:
+			void commit(Height commonHeight, Height newHeight, const consumer<cache::CatapultCacheDelta&>& modify) {
+				auto cacheDelta = m_cache.createDelta();
+				modify(cacheDelta);
+				m_records.capture(cacheDelta, commonHeight, newHeight);
+				m_cache.commit(newHeight);
+			}
+
+			void extend(Height newHeight, Amount amount) {
+				auto commonHeight = m_cache.createView().height();
+				commit(commonHeight, newHeight, [this, amount](auto& cacheDelta) {
+					setBalance(cacheDelta, Account2, amount);
+					cacheDelta.dependentState().NumTotalTransactions += 1;
+				});
+			}
+
+			void setBalance(cache::CatapultCacheDelta& cacheDelta, const Address& address, Amount amount) const {
+				auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+				if (!accountStateCacheDelta.contains(address))
+					accountStateCacheDelta.addAccount(address, Height(7));
+
+				auto& balances = accountStateCacheDelta.find(address).get().Balances;
+				balances.debit(Test_Mosaic_Id, balances.get(Test_Mosaic_Id));
+				balances.credit(Test_Mosaic_Id, amount);
+			}
+
+			void removeAccount(cache::CatapultCacheDelta& cacheDelta, const Address& address) const {
+				auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+				accountStateCacheDelta.queueRemove(address, Height(7));
+				accountStateCacheDelta.commitRemovals();
+			}
+
+			Amount getBalance(const cache::CatapultCacheDelta& cacheDelta, const Address& address) const {
+				const auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+				auto accountStateIter = accountStateCacheDelta.find(address);
+				return accountStateIter.tryGet() ? accountStateIter.get().Balances.get(Test_Mosaic_Id) : Amount();
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+			UndoRecords m_records;
+		};
+
+		// endregion
+	}
+
+	// region capture
+
+	TEST(TEST_CLASS, CanCreateEmptyRecords) {
+		// Act:
+		auto cache = test::CreateEmptyCatapultCache();
+		UndoRecords records(cache, Max_Rollback_Blocks);
+
+		// Assert:
+		EXPECT_EQ(0u, records.size());
+	}
+
+	TEST(TEST_CLASS, CaptureAddsRecordWhenChainIsExtended) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.extend(Height(2), Amount(300));
+		context.extend(Height(5), Amount(400));
+
+		// Assert:
+		EXPECT_EQ(3u, context.records().size());
+	}
+
+	TEST(TEST_CLASS, CaptureClearsRecordsWhenChainIsRolledBack) {
+		// Arrange:
+		TestContext context;
+		context.extend(Height(2), Amount(300));
+		context.extend(Height(3), Amount(400));
+
+		// Act: replace the block at height 3
+		context.commit(Height(2), Height(3), [&context](auto& cacheDelta) {
+			context.setBalance(cacheDelta, context.Account1, Amount(500));
+		});
+
+		// Assert:
+		EXPECT_EQ(0u, context.records().size());
+	}
+
+	TEST(TEST_CLASS, CaptureClearsRecordsWhenCacheWasCommittedWithoutCapture) {
+		// Arrange:
+		TestContext context;
+		context.extend(Height(2), Amount(300));
+		{
+			auto cacheDelta = context.cache().createDelta();
+			context.cache().commit(Height(3));
+		}
+
+		// Act:
+		context.extend(Height(4), Amount(400));
+
+		// Assert: only the most recent record is retained
+		EXPECT_EQ(1u, context.records().size());
+	}
+
+	TEST(TEST_CLASS, CapturePrunesRecordsOutsideRollbackWindow) {
+		// Arrange:
+		TestContext context;
+
+		// Act: record ranges starting at heights [1, 14]
+		for (auto i = 2u; i <= 15; ++i)
+			context.extend(Height(i), Amount(i));
+
+		// Assert: only records starting at heights [5, 14] can be used to roll back from height 15
+		EXPECT_EQ(Max_Rollback_Blocks, context.records().size());
+	}
+
+	// endregion
+
+	// region tryUndo
+
+	namespace {
+		void AssertCannotUndo(TestContext& context, Height commonHeight) {
+			// Act:
+			auto cacheDelta = context.cache().createDelta();
+			auto result = context.records().tryUndo(cacheDelta, commonHeight);
+
+			// Assert: the delta was not modified
+			EXPECT_FALSE(result);
+			EXPECT_TRUE(cacheDelta.sub<cache::AccountStateCache>().addedElements().empty());
+			EXPECT_TRUE(cacheDelta.sub<cache::AccountStateCache>().modifiedElements().empty());
+			EXPECT_TRUE(cacheDelta.sub<cache::AccountStateCache>().removedElements().empty());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotUndoWithoutRecords) {
+		// Arrange:
+		auto cache = test::CreateEmptyCatapultCache();
+		UndoRecords records(cache, Max_Rollback_Blocks);
+
+		// Act:
+		auto cacheDelta = cache.createDelta();
+		auto result = records.tryUndo(cacheDelta, Height(0));
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	TEST(TEST_CLASS, CannotUndoToHeightInsideRecord) {
+		// Arrange:
+		TestContext context;
+		context.extend(Height(4), Amount(300));
+
+		// Act + Assert:
+		AssertCannotUndo(context, Height(2));
+		AssertCannotUndo(context, Height(3));
+	}
+
+	TEST(TEST_CLASS, CannotUndoToHeightBeforeOldestRecord) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 2u; i <= 15; ++i)
+			context.extend(Height(i), Amount(i));
+
+		// Act + Assert:
+		AssertCannotUndo(context, Height(4));
+	}
+
+	TEST(TEST_CLASS, CannotUndoWhenCacheWasCommittedWithoutCapture) {
+		// Arrange:
+		TestContext context;
+		context.extend(Height(2), Amount(300));
+		{
+			auto cacheDelta = context.cache().createDelta();
+			context.cache().commit(Height(3));
+		}
+
+		// Act + Assert:
+		AssertCannotUndo(context, Height(1));
+	}
+
+	TEST(TEST_CLASS, CanUndoSingleRecord) {
+		// Arrange: add, modify and remove accounts
+		TestContext context;
+		context.commit(Height(1), Height(2), [&context](auto& cacheDelta) {
+			context.setBalance(cacheDelta, context.Account1, Amount(111));
+			context.removeAccount(cacheDelta, context.Account2);
+			context.setBalance(cacheDelta, context.Account3, Amount(333));
+			cacheDelta.dependentState().NumTotalTransactions = 5;
+		});
+
+		// Act:
+		auto cacheDelta = context.cache().createDelta();
+		auto result = context.records().tryUndo(cacheDelta, Height(1));
+
+		// Assert: all changes are reverted, including dependent state
+		EXPECT_TRUE(result);
+		EXPECT_EQ(2u, cacheDelta.sub<cache::AccountStateCache>().size());
+		EXPECT_EQ(Amount(100), context.getBalance(cacheDelta, context.Account1));
+		EXPECT_EQ(Amount(200), context.getBalance(cacheDelta, context.Account2));
+		EXPECT_FALSE(cacheDelta.sub<cache::AccountStateCache>().contains(context.Account3));
+		EXPECT_EQ(1u, cacheDelta.dependentState().NumTotalTransactions);
+
+		// - records are not consumed
+		EXPECT_EQ(2u, context.records().size());
+	}
+
+	TEST(TEST_CLASS, CanUndoMultipleRecords) {
+		// Arrange:
+		TestContext context;
+		context.extend(Height(2), Amount(300));
+		context.extend(Height(4), Amount(400));
+		context.extend(Height(5), Amount(500));
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i) {
+			auto expectedBalance = std::array<Amount, 3>{ { Amount(200), Amount(300), Amount(400) } }[i];
+			auto commonHeight = std::array<Height, 3>{ { Height(1), Height(2), Height(4) } }[i];
+
+			auto cacheDelta = context.cache().createDelta();
+			auto result = context.records().tryUndo(cacheDelta, commonHeight);
+
+			EXPECT_TRUE(result) << commonHeight;
+			EXPECT_EQ(expectedBalance, context.getBalance(cacheDelta, context.Account2)) << commonHeight;
+			EXPECT_EQ(1u + i, cacheDelta.dependentState().NumTotalTransactions) << commonHeight;
+		}
+	}
+
+	// endregion
+}}
@@ -23,6 +23,7 @@
 #include "catapult/consumers/BlockConsumers.h"
 #include "catapult/consumers/TransactionConsumers.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 
 using catapult::disruptor::ConsumerInput;
@@ -36,7 +37,10 @@ namespace catapult { namespace test {
 
 			// 2. add all hashes
 			auto transactionRegistry = mocks::CreateDefaultTransactionRegistry();
-			auto consumer = consumers::CreateBlockHashCalculatorConsumer(GetDefaultGenerationHash(), transactionRegistry);
+			auto consumer = consumers::CreateBlockHashCalculatorConsumer(
+					GetDefaultGenerationHash(),
+					transactionRegistry,
+					CreateStartedIoThreadPool());
 			consumer(input.blocks());
 			return std::move(input);
 		}
@@ -44,7 +48,10 @@ namespace catapult { namespace test {
 		ConsumerInput PrepareTransactionInput(ConsumerInput&& input) {
 			// 1. add all hashes
 			auto transactionRegistry = mocks::CreateDefaultTransactionRegistry();
-			auto consumer = consumers::CreateTransactionHashCalculatorConsumer(GetDefaultGenerationHash(), transactionRegistry);
+			auto consumer = consumers::CreateTransactionHashCalculatorConsumer(
+					GetDefaultGenerationHash(),
+					transactionRegistry,
+					CreateStartedIoThreadPool());
 			consumer(input.transactions());
 			return std::move(input);
 		}
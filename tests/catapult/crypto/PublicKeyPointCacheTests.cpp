@@ -0,0 +1,245 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/PublicKeyPointCache.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS PublicKeyPointCacheTests
+
+	namespace {
+		DecompressedPublicKey CreatePoint(uint8_t seed) {
+			DecompressedPublicKey point;
+			for (auto i = 0u; i < sizeof(point.Data); ++i)
+				point.Data[i] = static_cast<uint8_t>(seed + i);
+
+			return point;
+		}
+
+		Key CreateKey(uint8_t shardByte, uint8_t id) {
+			// first byte determines shard
+			Key key{};
+			key[0] = shardByte;
+			key[4] = id;
+			return key;
+		}
+
+		void AssertPointsEqual(const DecompressedPublicKey& expected, const DecompressedPublicKey& actual, const std::string& message) {
+			EXPECT_EQ_MEMORY(expected.Data, actual.Data, sizeof(expected.Data)) << message;
+		}
+
+		void AssertCached(PublicKeyPointCache& cache, const Key& key, const DecompressedPublicKey& expectedPoint) {
+			DecompressedPublicKey point;
+			auto isFound = cache.tryFind(key, point);
+			EXPECT_TRUE(isFound) << test::ToString(key);
+			if (isFound)
+				AssertPointsEqual(expectedPoint, point, test::ToString(key));
+		}
+
+		void AssertNotCached(PublicKeyPointCache& cache, const Key& key) {
+			DecompressedPublicKey point;
+			EXPECT_FALSE(cache.tryFind(key, point)) << test::ToString(key);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		PublicKeyPointCache cache(100);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region tryFind / insert
+
+	TEST(TEST_CLASS, CannotFindUnknownKey) {
+		// Arrange:
+		PublicKeyPointCache cache(100);
+		cache.insert(CreateKey(1, 1), CreatePoint(1));
+
+		// Act + Assert:
+		AssertNotCached(cache, CreateKey(1, 2));
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(1u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, CanFindInsertedKeys) {
+		// Arrange:
+		PublicKeyPointCache cache(100);
+		for (uint8_t i = 0; i < 10; ++i)
+			cache.insert(CreateKey(i, i), CreatePoint(i));
+
+		// Act + Assert:
+		EXPECT_EQ(10u, cache.size());
+		for (uint8_t i = 0; i < 10; ++i)
+			AssertCached(cache, CreateKey(i, i), CreatePoint(i));
+
+		EXPECT_EQ(10u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, InsertOfKnownKeyDoesNotChangePoint) {
+		// Arrange:
+		PublicKeyPointCache cache(100);
+		cache.insert(CreateKey(1, 1), CreatePoint(1));
+
+		// Act:
+		cache.insert(CreateKey(1, 1), CreatePoint(2));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		AssertCached(cache, CreateKey(1, 1), CreatePoint(1));
+	}
+
+	TEST(TEST_CLASS, InsertHasNoEffectWhenCacheIsDisabled) {
+		// Arrange:
+		PublicKeyPointCache cache(0);
+
+		// Act:
+		cache.insert(CreateKey(1, 1), CreatePoint(1));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertNotCached(cache, CreateKey(1, 1));
+	}
+
+	TEST(TEST_CLASS, LookupIsNotCountedWhenCacheIsDisabled) {
+		// Arrange:
+		PublicKeyPointCache cache(0);
+
+		// Act:
+		for (uint8_t i = 0; i < 10; ++i)
+			AssertNotCached(cache, CreateKey(i, i));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, InsertIntoFullShardEvictsLeastRecentlyUsedKey) {
+		// Arrange: max size 48 and 16 shards => 3 points per shard; all keys below map to same shard
+		PublicKeyPointCache cache(48);
+		for (uint8_t i = 0; i < 3; ++i)
+			cache.insert(CreateKey(0, i), CreatePoint(i));
+
+		// - touch first key so that second key is least recently used
+		DecompressedPublicKey point;
+		cache.tryFind(CreateKey(0, 0), point);
+
+		// Act:
+		cache.insert(CreateKey(0, 3), CreatePoint(3));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		AssertCached(cache, CreateKey(0, 0), CreatePoint(0));
+		AssertNotCached(cache, CreateKey(0, 1));
+		AssertCached(cache, CreateKey(0, 2), CreatePoint(2));
+		AssertCached(cache, CreateKey(0, 3), CreatePoint(3));
+	}
+
+	TEST(TEST_CLASS, InsertIntoFullShardDoesNotAffectOtherShards) {
+		// Arrange:
+		PublicKeyPointCache cache(16);
+		cache.insert(CreateKey(0, 0), CreatePoint(0));
+		cache.insert(CreateKey(1, 0), CreatePoint(1));
+
+		// Act:
+		cache.insert(CreateKey(0, 1), CreatePoint(2));
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		AssertNotCached(cache, CreateKey(0, 0));
+		AssertCached(cache, CreateKey(1, 0), CreatePoint(1));
+		AssertCached(cache, CreateKey(0, 1), CreatePoint(2));
+	}
+
+	namespace {
+		void AssertCacheSizeIsBounded(size_t maxSize) {
+			// Arrange:
+			PublicKeyPointCache cache(maxSize);
+
+			// Act: insert enough points into every shard to fill it
+			for (uint8_t i = 0; i < 16; ++i) {
+				for (uint8_t j = 0; j <= maxSize / 16; ++j)
+					cache.insert(CreateKey(i, j), CreatePoint(i));
+			}
+
+			// Assert:
+			EXPECT_EQ(maxSize, cache.size()) << "max size " << maxSize;
+		}
+	}
+
+	TEST(TEST_CLASS, CacheHoldsExactlyMaxSizePoints) {
+		AssertCacheSizeIsBounded(1);
+		AssertCacheSizeIsBounded(5);
+		AssertCacheSizeIsBounded(15);
+		AssertCacheSizeIsBounded(16);
+		AssertCacheSizeIsBounded(50);
+		AssertCacheSizeIsBounded(100);
+	}
+
+	// endregion
+
+	// region thread safety
+
+	TEST(TEST_CLASS, CacheIsThreadSafe) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Keys = 200u;
+		PublicKeyPointCache cache(100);
+
+		// Act: insert and look up overlapping keys from multiple threads
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&cache]() {
+				for (auto j = 0u; j < Num_Keys; ++j) {
+					auto key = CreateKey(static_cast<uint8_t>(j), static_cast<uint8_t>(j / 16));
+					DecompressedPublicKey point;
+					if (cache.tryFind(key, point))
+						AssertPointsEqual(CreatePoint(static_cast<uint8_t>(j)), point, std::to_string(j));
+					else
+						cache.insert(key, CreatePoint(static_cast<uint8_t>(j)));
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_GE(100u, cache.size());
+		EXPECT_EQ(Num_Threads * Num_Keys, cache.numHits() + cache.numMisses());
+	}
+
+	// endregion
+}}
@@ -20,6 +20,7 @@
 
 #include "catapult/crypto/Signer.h"
 #include "catapult/crypto/KeyUtils.h"
+#include "catapult/crypto/PublicKeyPointCache.h"
 #include "tests/TestHarness.h"
 #include <numeric>
 
@@ -91,6 +92,84 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region Signer
+
+	TEST(TEST_CLASS, SignerExposesPublicKeyOfKeyPair) {
+		// Arrange:
+		auto keyPair = GetDefaultKeyPair();
+
+		// Act:
+		Signer signer(keyPair);
+
+		// Assert:
+		EXPECT_EQ(keyPair.publicKey(), signer.publicKey());
+	}
+
+	TEST(TEST_CLASS, SignerGeneratesSameSignatureAsSign_SingleBuffer) {
+		// Arrange:
+		auto keyPair = GetDefaultKeyPair();
+		Signer signer(keyPair);
+		auto payload = test::GenerateRandomArray<100>();
+
+		// Act:
+		Signature signature;
+		signer.sign(payload, signature);
+
+		// Assert:
+		EXPECT_EQ(SignPayload(keyPair, payload), signature);
+	}
+
+	TEST(TEST_CLASS, SignerGeneratesSameSignatureAsSign_MultipleBuffers) {
+		// Arrange:
+		auto keyPair = GetDefaultKeyPair();
+		Signer signer(keyPair);
+		auto payload1 = test::GenerateRandomArray<100>();
+		auto payload2 = test::GenerateRandomArray<50>();
+
+		// Act:
+		Signature signature;
+		signer.sign({ payload1, payload2 }, signature);
+
+		// Assert:
+		Signature expectedSignature;
+		Sign(keyPair, { payload1, payload2 }, expectedSignature);
+		EXPECT_EQ(expectedSignature, signature);
+	}
+
+	TEST(TEST_CLASS, SignerCanSignMultipleTimes) {
+		// Arrange:
+		auto keyPair = GetDefaultKeyPair();
+		Signer signer(keyPair);
+
+		for (auto i = 0u; i < 5; ++i) {
+			// Act:
+			auto payload = test::GenerateRandomArray<100>();
+			Signature signature;
+			signer.sign(payload, signature);
+
+			// Assert:
+			EXPECT_TRUE(Verify(keyPair.publicKey(), payload, signature)) << "signature " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, SignerDestructorZerosOutExpandedPrivateKey) {
+		// Arrange: call placement new
+		auto keyPair = GetDefaultKeyPair();
+		uint8_t signerMemory[sizeof(Signer)];
+		auto pSigner = new (signerMemory) Signer(keyPair);
+
+		// Sanity: the signer's backing memory (expanded private key followed by public key) is nonzero
+		EXPECT_FALSE(std::all_of(signerMemory, signerMemory + Hash512::Size, [](auto byte) { return 0 == byte; }));
+
+		// Act: destroy the signer
+		pSigner->~Signer();
+
+		// Assert: the expanded private key is zero
+		EXPECT_TRUE(std::all_of(signerMemory, signerMemory + Hash512::Size, [](auto byte) { return 0 == byte; }));
+	}
+
+	// endregion
+
 	// region Verify
 
 	TEST(TEST_CLASS, SignedDataCanBeVerified) {
@@ -253,6 +332,67 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region Verify - point cache
+
+	TEST(TEST_CLASS, SignedDataCanBeVerifiedWithPointCache) {
+		// Arrange:
+		PublicKeyPointCache pointCache(100);
+		auto payload = test::GenerateRandomArray<100>();
+		auto keyPair = GetDefaultKeyPair();
+		auto signature = SignPayload(keyPair, payload);
+
+		// Act:
+		auto isVerified1 = Verify(keyPair.publicKey(), { payload }, signature, pointCache);
+		auto isVerified2 = Verify(keyPair.publicKey(), { payload }, signature, pointCache);
+
+		// Assert: the first verification decompressed and cached the point, the second used it
+		EXPECT_TRUE(isVerified1);
+		EXPECT_TRUE(isVerified2);
+		EXPECT_EQ(1u, pointCache.size());
+		EXPECT_EQ(1u, pointCache.numHits());
+		EXPECT_EQ(1u, pointCache.numMisses());
+	}
+
+	TEST(TEST_CLASS, SignedDataCannotBeVerifiedWithPointCacheWhenPayloadIsModified) {
+		// Arrange: prime the cache
+		PublicKeyPointCache pointCache(100);
+		auto payload = test::GenerateRandomArray<100>();
+		auto keyPair = GetDefaultKeyPair();
+		auto signature = SignPayload(keyPair, payload);
+		Verify(keyPair.publicKey(), { payload }, signature, pointCache);
+
+		// Act:
+		payload[10] ^= 0xFF;
+		auto isVerified = Verify(keyPair.publicKey(), { payload }, signature, pointCache);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(1u, pointCache.numHits());
+	}
+
+	TEST(TEST_CLASS, PublicKeyNotOnACurveIsNotAddedToPointCache) {
+		// Arrange:
+		PublicKeyPointCache pointCache(100);
+		auto hackedKeyPair = GetDefaultKeyPair();
+		auto payload = test::GenerateRandomArray<100>();
+
+		auto& hackPublic = const_cast<Key&>(hackedKeyPair.publicKey());
+		std::fill(hackPublic.begin(), hackPublic.end(), static_cast<uint8_t>(0));
+		hackPublic[hackPublic.size() - 1] = 0x01;
+
+		auto signature = SignPayload(hackedKeyPair, payload);
+
+		// Act:
+		auto isVerified = Verify(hackedKeyPair.publicKey(), { payload }, signature, pointCache);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(0u, pointCache.size());
+		EXPECT_EQ(1u, pointCache.numMisses());
+	}
+
+	// endregion
+
 	// region VerifyMulti
 
 	namespace {
@@ -301,11 +441,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -316,6 +455,12 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			// Assert: failures are present in both the first and second batch
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58, 64, 99 }, mutator);
+		}
+
 		struct VerifyMultiTraits {
 			static std::pair<std::vector<bool>, bool> Verify(const std::vector<SignatureInput>& signatureInputs) {
 				return VerifyMulti(signatureInputs.data(), signatureInputs.size());
@@ -350,12 +495,46 @@ namespace catapult { namespace crypto {
 				EXPECT_EQ(expectedAggregateResult, result);
 			}
 		};
+
+		template<typename TTraits>
+		struct PointCacheTraits : public TTraits {
+			static auto Verify(const std::vector<SignatureInput>& signatureInputs) {
+				// verify twice so that second verification uses cached points
+				PublicKeyPointCache pointCache(1000);
+				auto result1 = VerifyWithCache(signatureInputs, pointCache, TTraits());
+				auto result2 = VerifyWithCache(signatureInputs, pointCache, TTraits());
+
+				EXPECT_EQ(result1, result2);
+				return result2;
+			}
+
+		private:
+			static auto VerifyWithCache(
+					const std::vector<SignatureInput>& signatureInputs,
+					PublicKeyPointCache& pointCache,
+					VerifyMultiTraits) {
+				return VerifyMulti(signatureInputs.data(), signatureInputs.size(), pointCache);
+			}
+
+			static auto VerifyWithCache(
+					const std::vector<SignatureInput>& signatureInputs,
+					PublicKeyPointCache& pointCache,
+					VerifyMultiShortCircuitTraits) {
+				return VerifyMultiShortCircuit(signatureInputs.data(), signatureInputs.size(), pointCache);
+			}
+		};
 	}
 
 #define VERIFY_MULTI_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_All) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_ShortCircuit) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiShortCircuitTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_All_PointCache) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PointCacheTraits<VerifyMultiTraits>>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_ShortCircuit_PointCache) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PointCacheTraits<VerifyMultiShortCircuitTraits>>(); \
+	} \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	VERIFY_MULTI_TEST(SignedPayloadsCanBeVerifiedAsBatches_LessThanBatchSize) {
@@ -411,6 +590,13 @@ namespace catapult { namespace crypto {
 		});
 	}
 
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_InvalidSignatureNotBatchVerified) {
+		// Assert: last signature is not batch verified
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(65, { 64 }, [](auto& signatureInputs, auto index) {
+			const_cast<uint8_t*>(signatureInputs[index].Buffers[0].pData)[13] ^= 0xFF;
+		});
+	}
+
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_NonCanonicalSignature) {
 		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
 			std::array<uint8_t, 10> payload{ { 1, 2, 3, 4, 5, 6, 7, 8, 9, 30 } };
@@ -506,6 +506,52 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region consumer latencies
+
+	TEST(TEST_CLASS, DispatcherHasLatencyHistogramPerConsumer) {
+		// Arrange + Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Assert:
+		auto latencies = dispatcher.consumerLatencies();
+		ASSERT_EQ(2u, latencies.size());
+		EXPECT_NE(latencies[0], latencies[1]);
+		EXPECT_EQ(0u, latencies[0]->count());
+		EXPECT_EQ(0u, latencies[1]->count());
+	}
+
+	TEST(TEST_CLASS, ConsumerLatenciesAreRecordedForAllProcessedElements) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					CreateNoOpConsumer(),
+					CreateSkipIfFirstBlockIsEvenConsumer(),
+					CreateNoOpConsumer()
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert: elements skipped by the second consumer are not processed (or timed) by the third consumer
+		auto latencies = dispatcher.consumerLatencies();
+		ASSERT_EQ(3u, latencies.size());
+		EXPECT_EQ(5u, latencies[0]->count());
+		EXPECT_EQ(5u, latencies[1]->count());
+		EXPECT_EQ(3u, latencies[2]->count());
+	}
+
+	// endregion
+
 	// region exception + space exhaution
 
 #ifdef __clang__
@@ -22,6 +22,7 @@
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/extensions/ServiceLocator.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "catapult/utils/TimeSpan.h"
 #include "tests/test/core/SchedulerTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
@@ -120,6 +121,28 @@ namespace catapult { namespace extensions {
 		isElementCallbackUnblocked.state()->set();
 	}
 
+	TEST(TEST_CLASS, CanAddDispatcherLatenciesToRegistry) {
+		// Arrange: create a dispatcher with two consumers
+		auto options = disruptor::ConsumerDispatcherOptions{ "ConsumerDispatcherTests", 16u * 1024 };
+		auto consumer = [](const auto&) { return disruptor::ConsumerResult::Continue(); };
+		disruptor::ConsumerDispatcher dispatcher(options, std::vector<disruptor::DisruptorConsumer>{ consumer, consumer });
+
+		utils::LatencyHistogramRegistry registry;
+
+		// Act:
+		AddDispatcherLatencies(registry, dispatcher, "XYZ");
+
+		// Assert:
+		auto entries = registry.entries();
+		auto latencies = dispatcher.consumerLatencies();
+		ASSERT_EQ(2u, entries.size());
+		for (auto i = 0u; i < entries.size(); ++i) {
+			EXPECT_EQ("XYZ ELEM LAT", entries[i].Id.name()) << i;
+			EXPECT_EQ(i, entries[i].Index) << i;
+			EXPECT_EQ(latencies[i], entries[i].pHistogram) << i;
+		}
+	}
+
 	TEST(TEST_CLASS, CanCreateBatchTransactionTask) {
 		// Arrange:
 		auto pDispatcher = CreateDispatcher();
@@ -24,6 +24,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/other/mocks/MockNodeSubscriber.h"
@@ -60,6 +61,7 @@ namespace catapult { namespace extensions {
 		mocks::MockNodeSubscriber nodeSubscriber;
 
 		std::vector<utils::DiagnosticCounter> counters;
+		utils::LatencyHistogramRegistry latencyHistograms;
 		auto pluginManager = test::CreatePluginManager(config.BlockChain);
 		thread::MultiServicePool pool("test", 1);
 
@@ -76,6 +78,7 @@ namespace catapult { namespace extensions {
 				stateChangeSubscriber,
 				nodeSubscriber,
 				counters,
+				latencyHistograms,
 				pluginManager,
 				pool);
 
@@ -93,6 +96,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(&nodeSubscriber, &state.nodeSubscriber());
 
 		EXPECT_EQ(&counters, &state.counters());
+		EXPECT_EQ(&latencyHistograms, &state.latencyHistograms());
 		EXPECT_EQ(&pluginManager, &state.pluginManager());
 		EXPECT_EQ(&pool, &state.pool());
 
@@ -24,7 +24,9 @@
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticLatencyValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
 #include "tests/test/core/BlockStatementTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -139,6 +141,109 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticLatenciesHandler
+
+	TEST(TEST_CLASS, DiagnosticLatenciesHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		utils::LatencyHistogramRegistry registry;
+		RegisterDiagnosticLatenciesHandler(handlers, registry);
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Diagnostic_Latencies);
+	}
+
+	namespace {
+		template<typename TAssertHandlerContext>
+		void AssertDiagnosticLatenciesHandlerWritesSummariesInResponseToValidRequest(
+				const utils::LatencyHistogramRegistry& registry,
+				TAssertHandlerContext assertHandlerContext) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterDiagnosticLatenciesHandler(handlers, registry);
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Diagnostic_Latencies;
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert: header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + registry.size() * sizeof(model::DiagnosticLatencyValue);
+			test::AssertPacketHeader(context, expectedPacketSize, ionet::PacketType::Diagnostic_Latencies);
+
+			// - summaries are written
+			assertHandlerContext(context);
+		}
+
+		std::shared_ptr<utils::LatencyHistogram> CreateHistogramWithTenValues() {
+			auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+			for (auto i = 1u; i <= 10; ++i)
+				pHistogram->record(i);
+
+			return pHistogram;
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticLatenciesHandler_WritesSummariesInResponseToValidRequest_ZeroHistograms) {
+		// Arrange:
+		utils::LatencyHistogramRegistry registry;
+
+		// Assert:
+		AssertDiagnosticLatenciesHandlerWritesSummariesInResponseToValidRequest(registry, [](const auto& context) {
+			EXPECT_TRUE(context.response().buffers().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticLatenciesHandler_WritesSummariesInResponseToValidRequest_MultipleHistograms) {
+		// Arrange: values small enough to have dedicated buckets are reported exactly
+		utils::LatencyHistogramRegistry registry;
+		registry.add("ALPHA", 3, CreateHistogramWithTenValues());
+		registry.add("BETA", 0, std::make_shared<utils::LatencyHistogram>());
+
+		// Assert:
+		AssertDiagnosticLatenciesHandlerWritesSummariesInResponseToValidRequest(registry, [](const auto& context) {
+			const auto* pLatencyValue = reinterpret_cast<const model::DiagnosticLatencyValue*>(test::GetSingleBufferData(context));
+			EXPECT_EQ(utils::DiagnosticCounterId("ALPHA").value(), pLatencyValue->Id);
+			EXPECT_EQ(3u, pLatencyValue->Index);
+			EXPECT_EQ(10u, pLatencyValue->Count);
+			EXPECT_EQ(5u, pLatencyValue->Median);
+			EXPECT_EQ(10u, pLatencyValue->Percentile99);
+			EXPECT_EQ(10u, pLatencyValue->Max);
+
+			++pLatencyValue;
+			EXPECT_EQ(utils::DiagnosticCounterId("BETA").value(), pLatencyValue->Id);
+			EXPECT_EQ(0u, pLatencyValue->Index);
+			EXPECT_EQ(0u, pLatencyValue->Count);
+			EXPECT_EQ(0u, pLatencyValue->Median);
+			EXPECT_EQ(0u, pLatencyValue->Percentile99);
+			EXPECT_EQ(0u, pLatencyValue->Max);
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticLatenciesHandler_WritesHistogramsAddedAfterRegistration) {
+		// Arrange:
+		utils::LatencyHistogramRegistry registry;
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticLatenciesHandler(handlers, registry);
+
+		registry.add("ALPHA", 0, CreateHistogramWithTenValues());
+
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Latencies;
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert:
+		test::AssertPacketHeader(context, sizeof(ionet::PacketHeader) + sizeof(model::DiagnosticLatencyValue), pPacket->Type);
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	TEST(TEST_CLASS, DiagnosticNodesHandler_DoesNotRespondToMalformedRequest) {
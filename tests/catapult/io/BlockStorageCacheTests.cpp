@@ -484,6 +484,102 @@ namespace catapult { namespace io {
 		test::AssertEqual(newBlockElement, *cache.view().loadBlockElement(Height(9)));
 	}
 
+	TEST(TEST_CLASS, ViewDoesNotSeeBlocksCommittedAfterViewIsCreated) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+		auto view = cache.view();
+
+		// Act: commit a block without rollback, which is not blocked by the view
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(13));
+		{
+			auto modifier = cache.modifier();
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock));
+			modifier.commit();
+		}
+
+		// Assert: the view is unchanged
+		EXPECT_EQ(Height(12), view.chainHeight());
+		EXPECT_EQ(12u, view.loadHashesFrom(Height(1), 100).size());
+		EXPECT_EQ(0u, view.loadHashesFrom(Height(13), 100).size());
+		EXPECT_THROW(view.loadBlock(Height(13)), catapult_invalid_argument);
+
+		// - a new view sees the new block
+		EXPECT_EQ(Height(13), cache.view().chainHeight());
+		EXPECT_EQ(*pNewBlock, *cache.view().loadBlock(Height(13)));
+	}
+
+	TEST(TEST_CLASS, CommitWithRollbackIsBlockedByView) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+
+		// Assert:
+		test::AssertExclusiveLocks(
+				[&cache]() { return cache.view(); },
+				[&cache]() {
+					auto modifier = cache.modifier();
+					modifier.dropBlocksAfter(Height(8));
+					modifier.commit();
+				});
+
+		EXPECT_EQ(Height(8), cache.view().chainHeight());
+	}
+
+	// endregion
+
+	// region latencies
+
+	TEST(TEST_CLASS, LatenciesAreInitiallyEmpty) {
+		// Act:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+
+		// Assert:
+		const auto& latencies = cache.latencies();
+		EXPECT_EQ(0u, latencies.pLoad->count());
+		EXPECT_EQ(0u, latencies.pSave->count());
+		EXPECT_EQ(0u, latencies.pCommit->count());
+	}
+
+	TEST(TEST_CLASS, ViewLoadsFromStorageRecordLoadLatencies) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+
+		// Act: loads of the (cached) top block are not recorded
+		auto view = cache.view();
+		view.loadHashesFrom(Height(1), 100);
+		view.loadBlock(Height(7));
+		view.loadBlock(Height(12));
+		view.loadBlockElement(Height(8));
+		view.loadBlockElement(Height(12));
+
+		// Assert:
+		const auto& latencies = cache.latencies();
+		EXPECT_EQ(3u, latencies.pLoad->count());
+		EXPECT_EQ(0u, latencies.pSave->count());
+		EXPECT_EQ(0u, latencies.pCommit->count());
+	}
+
+	TEST(TEST_CLASS, ModifierSavesAndCommitsRecordLatencies) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+		auto pNewBlock1 = test::GenerateBlockWithTransactions(5, Height(13));
+		auto pNewBlock2 = test::GenerateBlockWithTransactions(5, Height(14));
+		auto pNewBlock3 = test::GenerateBlockWithTransactions(5, Height(15));
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock1));
+			modifier.saveBlocks({ test::CreateBlockElementForSaveTests(*pNewBlock2), test::CreateBlockElementForSaveTests(*pNewBlock3) });
+			modifier.commit();
+		}
+
+		// Assert:
+		const auto& latencies = cache.latencies();
+		EXPECT_EQ(0u, latencies.pLoad->count());
+		EXPECT_EQ(2u, latencies.pSave->count());
+		EXPECT_EQ(1u, latencies.pCommit->count());
+	}
+
 	// endregion
 
 	// region synchronization
@@ -494,7 +590,7 @@ namespace catapult { namespace io {
 		}
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS)
+	DEFINE_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS)
 
 	// endregion
 }}
@@ -615,8 +615,9 @@ namespace catapult { namespace ionet {
 		NodeContainer container;
 		auto keys = SeedThreeNodes(container);
 
-		// Act:
-		const auto& connectionState = container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[1]);
+		// Act: connection state references are only valid for the lifetime of the modifier
+		auto modifier = container.modifier();
+		const auto& connectionState = modifier.provisionConnectionState(ServiceIdentifier(123), keys[1]);
 
 		// Assert:
 		test::AssertZeroed(connectionState);
@@ -626,13 +627,17 @@ namespace catapult { namespace ionet {
 		// Arrange:
 		NodeContainer container;
 		auto keys = SeedThreeNodes(container);
-		const auto& originalConnectionState = container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[1]);
+		container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[1]).Age = 7;
+
+		auto modifier = container.modifier();
+		const auto& originalConnectionState = modifier.provisionConnectionState(ServiceIdentifier(123), keys[1]);
 
 		// Act:
-		const auto& connectionState = container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[1]);
+		const auto& connectionState = modifier.provisionConnectionState(ServiceIdentifier(123), keys[1]);
 
 		// Assert:
 		EXPECT_EQ(&originalConnectionState, &connectionState);
+		EXPECT_EQ(7u, connectionState.Age);
 	}
 
 	TEST(TEST_CLASS, ProvisionConnectionStateReturnsUniqueConnectionStatePerNode) {
@@ -641,8 +646,9 @@ namespace catapult { namespace ionet {
 		auto keys = SeedThreeNodes(container);
 
 		// Act:
-		const auto& connectionState1 = container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[0]);
-		const auto& connectionState2 = container.modifier().provisionConnectionState(ServiceIdentifier(123), keys[2]);
+		auto modifier = container.modifier();
+		const auto& connectionState1 = modifier.provisionConnectionState(ServiceIdentifier(123), keys[0]);
+		const auto& connectionState2 = modifier.provisionConnectionState(ServiceIdentifier(123), keys[2]);
 
 		// Assert:
 		EXPECT_NE(&connectionState1, &connectionState2);
@@ -890,6 +896,53 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region snapshots
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesMadeAfterViewIsCreated) {
+		// Arrange:
+		NodeContainer container;
+		auto keys = SeedThreeNodes(container);
+		auto view = container.view();
+
+		// Act:
+		Add(container, test::GenerateRandomByteArray<Key>(), "dolly", NodeSource::Dynamic);
+		container.modifier().incrementSuccesses(keys[1]);
+
+		// Assert:
+		EXPECT_EQ(3u, view.size());
+		EXPECT_EQ(0u, view.getNodeInfo(keys[1]).interactions(Timestamp()).NumSuccesses);
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesOfActiveModifier) {
+		// Arrange:
+		NodeContainer container;
+		SeedThreeNodes(container);
+
+		// Act:
+		auto modifier = container.modifier();
+		modifier.add(test::CreateNamedNode(test::GenerateRandomByteArray<Key>(), "dolly"), NodeSource::Dynamic);
+
+		// Assert:
+		EXPECT_EQ(3u, container.view().size());
+	}
+
+	TEST(TEST_CLASS, ViewSeesChangesAfterModifierIsDestroyed) {
+		// Arrange:
+		NodeContainer container;
+		SeedThreeNodes(container);
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.add(test::CreateNamedNode(test::GenerateRandomByteArray<Key>(), "dolly"), NodeSource::Dynamic);
+		}
+
+		// Assert:
+		EXPECT_EQ(4u, container.view().size());
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -898,7 +951,7 @@ namespace catapult { namespace ionet {
 		}
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS)
+	DEFINE_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS)
 
 	// endregion
 }}
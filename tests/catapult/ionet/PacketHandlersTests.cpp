@@ -383,6 +383,75 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region handlerLatencies
+
+	TEST(TEST_CLASS, HandlerLatenciesAreInitiallyEmpty) {
+		// Arrange:
+		PacketHandlers handlers;
+
+		// Act:
+		auto latencies = handlers.handlerLatencies();
+
+		// Assert:
+		EXPECT_TRUE(latencies.empty());
+	}
+
+	TEST(TEST_CLASS, HandlerLatenciesContainsHistogramPerRegisteredHandler) {
+		// Arrange:
+		auto marker = 0u;
+		PacketHandlers handlers;
+		RegisterHandlers(handlers, { 1, 3, 5 }, marker);
+
+		// Act:
+		auto latencies = handlers.handlerLatencies();
+
+		// Assert:
+		ASSERT_EQ(3u, latencies.size());
+		EXPECT_EQ(static_cast<PacketType>(1), latencies[0].first);
+		EXPECT_EQ(static_cast<PacketType>(3), latencies[1].first);
+		EXPECT_EQ(static_cast<PacketType>(5), latencies[2].first);
+
+		for (const auto& pair : latencies)
+			EXPECT_EQ(0u, pair.second->count()) << pair.first;
+	}
+
+	TEST(TEST_CLASS, ProcessRecordsLatencyOfMatchingHandler) {
+		// Arrange:
+		auto marker = 0u;
+		PacketHandlers handlers;
+		RegisterHandlers(handlers, { 1, 3, 5 }, marker);
+
+		// Act:
+		ProcessPacket(handlers, 3);
+		ProcessPacket(handlers, 5);
+		ProcessPacket(handlers, 3);
+		ProcessPacket(handlers, 4);
+
+		// Assert:
+		auto latencies = handlers.handlerLatencies();
+		ASSERT_EQ(3u, latencies.size());
+		EXPECT_EQ(0u, latencies[0].second->count());
+		EXPECT_EQ(2u, latencies[1].second->count());
+		EXPECT_EQ(1u, latencies[2].second->count());
+	}
+
+	TEST(TEST_CLASS, HandlerLatenciesAreSharedByCopies) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 3);
+		auto handlersCopy = handlers;
+
+		// Act:
+		ProcessPacket(handlersCopy, 3);
+
+		// Assert:
+		auto latencies = handlers.handlerLatencies();
+		ASSERT_EQ(1u, latencies.size());
+		EXPECT_EQ(1u, latencies[0].second->count());
+	}
+
+	// endregion
+
 	// region process + setAllowedHosts
 
 	namespace {
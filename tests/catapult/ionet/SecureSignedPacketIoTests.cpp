@@ -379,10 +379,16 @@ namespace catapult { namespace ionet {
 	TEST(TEST_CLASS, CanRoundtripWriteAndRead) {
 		// Arrange:
 		TestContext context;
-		context.KeyPair = std::move(context.RemoteKeyPair); // the writer should emulate the remote so keys match for write and read
+
+		// - the writer should emulate the remote so keys match for write and read
+		auto pSecureIo = CreateSecureSignedPacketIo(
+				context.pMockPacketIo,
+				context.RemoteKeyPair,
+				context.RemoteKey,
+				std::numeric_limits<uint32_t>::max());
 
 		// Act + Assert:
-		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *context.pSecureIo);
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *pSecureIo);
 	}
 
 	// endregion
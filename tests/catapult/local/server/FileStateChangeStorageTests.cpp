@@ -52,6 +52,14 @@ namespace catapult { namespace local {
 				CATAPULT_THROW_INVALID_ARGUMENT("apply - not supported in mock");
 			}
 
+			void apply(const cache::CacheChanges&, cache::CatapultCacheDelta&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("apply - not supported in mock");
+			}
+
+			std::unique_ptr<const cache::MemoryCacheChanges> createUndoChanges(const cache::CatapultCacheDelta&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("createUndoChanges - not supported in mock");
+			}
+
 		private:
 			uint32_t m_value;
 		};
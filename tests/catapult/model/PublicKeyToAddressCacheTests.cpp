@@ -0,0 +1,238 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/PublicKeyToAddressCache.h"
+#include "catapult/model/Address.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS PublicKeyToAddressCacheTests
+
+	namespace {
+		constexpr auto Network_Identifier = NetworkIdentifier::Mijin_Test;
+
+		Key CreateKey(uint8_t shardByte, uint8_t id) {
+			// first byte determines shard
+			Key key{};
+			key[0] = shardByte;
+			key[4] = id;
+			return key;
+		}
+
+		void AssertAddress(PublicKeyToAddressCache& cache, const Key& key) {
+			EXPECT_EQ(PublicKeyToAddress(key, Network_Identifier), cache.toAddress(key)) << test::ToString(key);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		PublicKeyToAddressCache cache(Network_Identifier, 100);
+
+		// Assert:
+		EXPECT_EQ(Network_Identifier, cache.networkIdentifier());
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region toAddress
+
+	TEST(TEST_CLASS, ToAddressCalculatesAndCachesUnknownKey) {
+		// Arrange:
+		PublicKeyToAddressCache cache(Network_Identifier, 100);
+		auto key = test::GenerateRandomByteArray<Key>();
+
+		// Act + Assert:
+		AssertAddress(cache, key);
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(1u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, ToAddressReturnsCachedAddressForKnownKey) {
+		// Arrange:
+		PublicKeyToAddressCache cache(Network_Identifier, 100);
+		auto key = test::GenerateRandomByteArray<Key>();
+		cache.toAddress(key);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i)
+			AssertAddress(cache, key);
+
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(3u, cache.numHits());
+		EXPECT_EQ(1u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, ToAddressUsesCacheNetworkIdentifier) {
+		// Arrange:
+		PublicKeyToAddressCache cache(NetworkIdentifier::Public, 100);
+		auto key = test::GenerateRandomByteArray<Key>();
+
+		// Act:
+		auto address = cache.toAddress(key);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(key, NetworkIdentifier::Public), address);
+		EXPECT_NE(PublicKeyToAddress(key, Network_Identifier), address);
+	}
+
+	TEST(TEST_CLASS, ToAddressCalculatesAddressWhenCacheIsDisabled) {
+		// Arrange:
+		PublicKeyToAddressCache cache(Network_Identifier, 0);
+		auto key = test::GenerateRandomByteArray<Key>();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i)
+			AssertAddress(cache, key);
+
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(3u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, ToAddressWithFullShardEvictsLeastRecentlyUsedKey) {
+		// Arrange: max size 48 and 16 shards => 3 addresses per shard; all keys below map to same shard
+		PublicKeyToAddressCache cache(Network_Identifier, 48);
+		for (uint8_t i = 0; i < 3; ++i)
+			cache.toAddress(CreateKey(0, i));
+
+		// - touch first key so that second key is least recently used
+		cache.toAddress(CreateKey(0, 0));
+
+		// Act:
+		cache.toAddress(CreateKey(0, 3));
+
+		// Assert: only the evicted key is a miss
+		EXPECT_EQ(3u, cache.size());
+		AssertAddress(cache, CreateKey(0, 0));
+		AssertAddress(cache, CreateKey(0, 2));
+		AssertAddress(cache, CreateKey(0, 3));
+		AssertAddress(cache, CreateKey(0, 1));
+
+		EXPECT_EQ(1u + 3, cache.numHits());
+		EXPECT_EQ(4u + 1, cache.numMisses());
+	}
+
+	namespace {
+		void AssertCacheSizeIsBounded(size_t maxSize) {
+			// Arrange:
+			PublicKeyToAddressCache cache(Network_Identifier, maxSize);
+
+			// Act: convert enough keys in every shard to fill it
+			for (uint8_t i = 0; i < 16; ++i) {
+				for (uint8_t j = 0; j <= maxSize / 16; ++j)
+					cache.toAddress(CreateKey(i, j));
+			}
+
+			// Assert:
+			EXPECT_EQ(maxSize, cache.size()) << "max size " << maxSize;
+		}
+	}
+
+	TEST(TEST_CLASS, CacheHoldsExactlyMaxSizeAddresses) {
+		AssertCacheSizeIsBounded(1);
+		AssertCacheSizeIsBounded(15);
+		AssertCacheSizeIsBounded(16);
+		AssertCacheSizeIsBounded(50);
+	}
+
+	// endregion
+
+	// region thread safety
+
+	TEST(TEST_CLASS, CacheIsThreadSafe) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Keys = 200u;
+		PublicKeyToAddressCache cache(Network_Identifier, 100);
+
+		// Act: convert overlapping keys from multiple threads
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&cache]() {
+				for (auto j = 0u; j < Num_Keys; ++j)
+					AssertAddress(cache, CreateKey(static_cast<uint8_t>(j), static_cast<uint8_t>(j / 16)));
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_GE(100u, cache.size());
+		EXPECT_EQ(Num_Threads * Num_Keys, cache.numHits() + cache.numMisses());
+	}
+
+	// endregion
+
+	// region process wide cache
+
+	TEST(TEST_CLASS, GetPublicKeyToAddressCacheReturnsSameCacheForSameNetwork) {
+		// Act:
+		auto& cache1 = GetPublicKeyToAddressCache(NetworkIdentifier::Mijin_Test);
+		auto& cache2 = GetPublicKeyToAddressCache(NetworkIdentifier::Mijin_Test);
+
+		// Assert:
+		EXPECT_EQ(&cache1, &cache2);
+		EXPECT_EQ(NetworkIdentifier::Mijin_Test, cache1.networkIdentifier());
+	}
+
+	TEST(TEST_CLASS, GetPublicKeyToAddressCacheReturnsDifferentCachesForDifferentNetworks) {
+		// Act:
+		auto& cache1 = GetPublicKeyToAddressCache(NetworkIdentifier::Mijin_Test);
+		auto& cache2 = GetPublicKeyToAddressCache(NetworkIdentifier::Public_Test);
+
+		// Assert:
+		EXPECT_NE(&cache1, &cache2);
+		EXPECT_EQ(NetworkIdentifier::Mijin_Test, cache1.networkIdentifier());
+		EXPECT_EQ(NetworkIdentifier::Public_Test, cache2.networkIdentifier());
+	}
+
+	TEST(TEST_CLASS, CachedPublicKeyToAddressUsesProcessWideCache) {
+		// Arrange:
+		auto& cache = GetPublicKeyToAddressCache(NetworkIdentifier::Public_Test);
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto numHits = cache.numHits();
+		auto numMisses = cache.numMisses();
+
+		// Act:
+		auto address1 = CachedPublicKeyToAddress(key, NetworkIdentifier::Public_Test);
+		auto address2 = CachedPublicKeyToAddress(key, NetworkIdentifier::Public_Test);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(key, NetworkIdentifier::Public_Test), address1);
+		EXPECT_EQ(address1, address2);
+		EXPECT_EQ(numHits + 1, cache.numHits());
+		EXPECT_EQ(numMisses + 1, cache.numMisses());
+	}
+
+	// endregion
+}}
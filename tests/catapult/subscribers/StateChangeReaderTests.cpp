@@ -55,6 +55,14 @@ namespace catapult { namespace subscribers {
 			void apply(const cache::CacheChanges&) const override {
 				CATAPULT_THROW_INVALID_ARGUMENT("apply - not supported in mock");
 			}
+
+			void apply(const cache::CacheChanges&, cache::CatapultCacheDelta&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("apply - not supported in mock");
+			}
+
+			std::unique_ptr<const cache::MemoryCacheChanges> createUndoChanges(const cache::CatapultCacheDelta&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("createUndoChanges - not supported in mock");
+			}
 		};
 
 		// cruft required for calling CacheChanges::sub
@@ -0,0 +1,212 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/EpochReclaimer.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS EpochReclaimerTests
+
+	namespace {
+		auto CreateCountingDeleter(size_t& numDeletes) {
+			return [&numDeletes]() { ++numDeletes; };
+		}
+	}
+
+	// region constructor / destructor
+
+	TEST(TEST_CLASS, CanCreateReclaimer) {
+		// Act:
+		EpochReclaimer reclaimer;
+
+		// Assert:
+		EXPECT_EQ(1u, reclaimer.epoch());
+		EXPECT_EQ(0u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, DestructorReclaimsAllPendingObjects) {
+		// Arrange:
+		size_t numDeletes = 0;
+		{
+			EpochReclaimer reclaimer;
+			auto readerGuard = reclaimer.enter();
+			reclaimer.retire(CreateCountingDeleter(numDeletes));
+			reclaimer.retire(CreateCountingDeleter(numDeletes));
+
+			// Sanity:
+			EXPECT_EQ(0u, reclaimer.reclaim());
+			EXPECT_EQ(0u, numDeletes);
+		}
+
+		// Assert:
+		EXPECT_EQ(2u, numDeletes);
+	}
+
+	// endregion
+
+	// region retire / reclaim
+
+	TEST(TEST_CLASS, RetireAdvancesEpoch) {
+		// Arrange:
+		EpochReclaimer reclaimer;
+
+		// Act:
+		reclaimer.retire([]() {});
+		reclaimer.retire([]() {});
+
+		// Assert:
+		EXPECT_EQ(3u, reclaimer.epoch());
+		EXPECT_EQ(2u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, ReclaimReclaimsAllObjectsWhenThereAreNoReaders) {
+		// Arrange:
+		size_t numDeletes = 0;
+		EpochReclaimer reclaimer;
+		reclaimer.retire(CreateCountingDeleter(numDeletes));
+		reclaimer.retire(CreateCountingDeleter(numDeletes));
+
+		// Act:
+		auto numReclaimed = reclaimer.reclaim();
+
+		// Assert:
+		EXPECT_EQ(2u, numReclaimed);
+		EXPECT_EQ(2u, numDeletes);
+		EXPECT_EQ(0u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, ReclaimDoesNotReclaimObjectsRetiredWhileReaderIsActive) {
+		// Arrange:
+		size_t numDeletes = 0;
+		EpochReclaimer reclaimer;
+		auto readerGuard = reclaimer.enter();
+		reclaimer.retire(CreateCountingDeleter(numDeletes));
+
+		// Act:
+		auto numReclaimed = reclaimer.reclaim();
+
+		// Assert:
+		EXPECT_EQ(0u, numReclaimed);
+		EXPECT_EQ(0u, numDeletes);
+		EXPECT_EQ(1u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, ReclaimReclaimsObjectsRetiredBeforeReaderEntered) {
+		// Arrange:
+		size_t numDeletes1 = 0;
+		size_t numDeletes2 = 0;
+		EpochReclaimer reclaimer;
+		reclaimer.retire(CreateCountingDeleter(numDeletes1));
+		auto readerGuard = reclaimer.enter();
+		reclaimer.retire(CreateCountingDeleter(numDeletes2));
+
+		// Act:
+		auto numReclaimed = reclaimer.reclaim();
+
+		// Assert: only the object retired before the reader entered was reclaimed
+		EXPECT_EQ(1u, numReclaimed);
+		EXPECT_EQ(1u, numDeletes1);
+		EXPECT_EQ(0u, numDeletes2);
+		EXPECT_EQ(1u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, ReclaimReclaimsObjectsAfterReaderExits) {
+		// Arrange:
+		size_t numDeletes = 0;
+		EpochReclaimer reclaimer;
+		{
+			auto readerGuard = reclaimer.enter();
+			reclaimer.retire(CreateCountingDeleter(numDeletes));
+		}
+
+		// Act:
+		auto numReclaimed = reclaimer.reclaim();
+
+		// Assert:
+		EXPECT_EQ(1u, numReclaimed);
+		EXPECT_EQ(1u, numDeletes);
+		EXPECT_EQ(0u, reclaimer.numPending());
+	}
+
+	TEST(TEST_CLASS, MovedReaderGuardKeepsReaderActive) {
+		// Arrange:
+		size_t numDeletes = 0;
+		EpochReclaimer reclaimer;
+		auto readerGuard = reclaimer.enter();
+		{
+			// Act: move the guard and destroy the source
+			auto sourceGuard = reclaimer.enter();
+			auto movedGuard = std::move(sourceGuard);
+			reclaimer.retire(CreateCountingDeleter(numDeletes));
+			reclaimer.reclaim();
+
+			// Assert:
+			EXPECT_EQ(0u, numDeletes);
+		}
+
+		// Assert: the first reader is still active
+		reclaimer.reclaim();
+		EXPECT_EQ(0u, numDeletes);
+	}
+
+	// endregion
+
+	// region enter
+
+	TEST(TEST_CLASS, EnterBlocksWhenAllReaderSlotsAreInUse) {
+		// Arrange:
+		EpochReclaimer reclaimer(2);
+		auto readerGuard1 = reclaimer.enter();
+
+		// Assert:
+		test::AssertExclusiveLocks(
+				[&reclaimer]() { return reclaimer.enter(); },
+				[&reclaimer]() { return reclaimer.enter(); });
+	}
+
+	// endregion
+
+	// region synchronize
+
+	TEST(TEST_CLASS, SynchronizeDoesNotBlockWhenThereAreNoReaders) {
+		// Arrange:
+		EpochReclaimer reclaimer;
+
+		// Act:
+		reclaimer.synchronize();
+
+		// Assert:
+		EXPECT_EQ(2u, reclaimer.epoch());
+	}
+
+	TEST(TEST_CLASS, SynchronizeBlocksUntilActiveReadersExit) {
+		// Arrange:
+		EpochReclaimer reclaimer;
+
+		// Assert:
+		test::AssertExclusiveLocks(
+				[&reclaimer]() { return reclaimer.enter(); },
+				[&reclaimer]() { reclaimer.synchronize(); });
+	}
+
+	// endregion
+}}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogramRegistry.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramRegistryTests
+
+	TEST(TEST_CLASS, RegistryIsInitiallyEmpty) {
+		// Act:
+		LatencyHistogramRegistry registry;
+
+		// Assert:
+		EXPECT_EQ(0u, registry.size());
+		EXPECT_TRUE(registry.entries().empty());
+	}
+
+	TEST(TEST_CLASS, CanAddHistograms) {
+		// Arrange:
+		LatencyHistogramRegistry registry;
+		auto pHistogram1 = std::make_shared<LatencyHistogram>();
+		auto pHistogram2 = std::make_shared<LatencyHistogram>();
+		auto pHistogram3 = std::make_shared<LatencyHistogram>();
+
+		// Act:
+		registry.add("ALPHA", 0, pHistogram1);
+		registry.add("ALPHA", 1, pHistogram2);
+		registry.add("BETA", 7, pHistogram3);
+
+		// Assert:
+		EXPECT_EQ(3u, registry.size());
+
+		auto entries = registry.entries();
+		ASSERT_EQ(3u, entries.size());
+
+		EXPECT_EQ("ALPHA", entries[0].Id.name());
+		EXPECT_EQ(0u, entries[0].Index);
+		EXPECT_EQ(pHistogram1, entries[0].pHistogram);
+
+		EXPECT_EQ("ALPHA", entries[1].Id.name());
+		EXPECT_EQ(1u, entries[1].Index);
+		EXPECT_EQ(pHistogram2, entries[1].pHistogram);
+
+		EXPECT_EQ("BETA", entries[2].Id.name());
+		EXPECT_EQ(7u, entries[2].Index);
+		EXPECT_EQ(pHistogram3, entries[2].pHistogram);
+	}
+
+	TEST(TEST_CLASS, CannotAddHistogramWithInvalidName) {
+		// Arrange:
+		LatencyHistogramRegistry registry;
+
+		// Act + Assert:
+		EXPECT_THROW(registry.add("ALPHA1", 0, std::make_shared<LatencyHistogram>()), catapult_invalid_argument);
+		EXPECT_EQ(0u, registry.size());
+	}
+
+	TEST(TEST_CLASS, EntriesShareHistogramsWithRegistrant) {
+		// Arrange:
+		LatencyHistogramRegistry registry;
+		auto pHistogram = std::make_shared<LatencyHistogram>();
+		registry.add("ALPHA", 0, pHistogram);
+
+		// Act:
+		pHistogram->record(10);
+		pHistogram->record(20);
+
+		// Assert:
+		auto entries = registry.entries();
+		ASSERT_EQ(1u, entries.size());
+		EXPECT_EQ(2u, entries[0].pHistogram->count());
+		EXPECT_EQ(20u, entries[0].pHistogram->max());
+	}
+}}
@@ -0,0 +1,181 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	// region bucket mapping
+
+	TEST(TEST_CLASS, SmallValuesHaveDedicatedBuckets) {
+		for (auto i = 0u; i < 16; ++i) {
+			// Act + Assert:
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(i)) << i;
+			EXPECT_EQ(i, LatencyHistogram::BucketUpperBound(i)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, LargeValuesShareLogarithmicBuckets) {
+		// Act + Assert: [16, 32) is split into eight buckets of two values each
+		EXPECT_EQ(16u, LatencyHistogram::BucketIndex(16));
+		EXPECT_EQ(16u, LatencyHistogram::BucketIndex(17));
+		EXPECT_EQ(17u, LatencyHistogram::BucketIndex(18));
+		EXPECT_EQ(23u, LatencyHistogram::BucketIndex(31));
+
+		// - [32, 64) is split into eight buckets of four values each
+		EXPECT_EQ(24u, LatencyHistogram::BucketIndex(32));
+		EXPECT_EQ(24u, LatencyHistogram::BucketIndex(35));
+		EXPECT_EQ(25u, LatencyHistogram::BucketIndex(36));
+
+		// - largest value maps to last bucket
+		EXPECT_EQ(LatencyHistogram::Num_Buckets - 1, LatencyHistogram::BucketIndex(std::numeric_limits<uint64_t>::max()));
+	}
+
+	TEST(TEST_CLASS, BucketUpperBoundIsLargestValueInBucket) {
+		for (auto i = 16u; i < LatencyHistogram::Num_Buckets - 1; ++i) {
+			// Act:
+			auto upperBound = LatencyHistogram::BucketUpperBound(i);
+
+			// Assert:
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(upperBound)) << i;
+			EXPECT_EQ(i + 1, LatencyHistogram::BucketIndex(upperBound + 1)) << i;
+		}
+
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), LatencyHistogram::BucketUpperBound(LatencyHistogram::Num_Buckets - 1));
+	}
+
+	// endregion
+
+	// region record / percentile
+
+	TEST(TEST_CLASS, CanCreateEmptyHistogram) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(50));
+		EXPECT_EQ(0u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanRecordSingleValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.record(1000);
+
+		// Assert: percentiles are capped by max
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(1000u, histogram.max());
+		EXPECT_EQ(1000u, histogram.percentile(0));
+		EXPECT_EQ(1000u, histogram.percentile(50));
+		EXPECT_EQ(1000u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanCalculatePercentilesOfExactValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto i = 1u; i <= 10; ++i)
+			histogram.record(i);
+
+		// Assert:
+		EXPECT_EQ(10u, histogram.count());
+		EXPECT_EQ(10u, histogram.max());
+		EXPECT_EQ(1u, histogram.percentile(10));
+		EXPECT_EQ(5u, histogram.percentile(50));
+		EXPECT_EQ(9u, histogram.percentile(90));
+		EXPECT_EQ(10u, histogram.percentile(99));
+	}
+
+	TEST(TEST_CLASS, CanCalculatePercentilesOfApproximateValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act: 98 fast values and 2 slow values
+		for (auto i = 0u; i < 98; ++i)
+			histogram.record(100);
+
+		histogram.record(5000);
+		histogram.record(10000);
+
+		// Assert: percentiles are within bucket precision
+		EXPECT_EQ(100u, histogram.count());
+		EXPECT_EQ(10000u, histogram.max());
+		EXPECT_EQ(LatencyHistogram::BucketUpperBound(LatencyHistogram::BucketIndex(100)), histogram.percentile(50));
+		EXPECT_EQ(LatencyHistogram::BucketUpperBound(LatencyHistogram::BucketIndex(5000)), histogram.percentile(99));
+		EXPECT_EQ(10000u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, HistogramIsThreadSafe) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Values = 1000u;
+		LatencyHistogram histogram;
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&histogram, i]() {
+				for (auto j = 0u; j < Num_Values; ++j)
+					histogram.record(i * Num_Values + j);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Values, histogram.count());
+		EXPECT_EQ(Num_Threads * Num_Values - 1, histogram.max());
+		EXPECT_EQ(Num_Threads * Num_Values - 1, histogram.percentile(100));
+	}
+
+	// endregion
+
+	// region LatencyRecorder
+
+	TEST(TEST_CLASS, LatencyRecorderRecordsElapsedTimeWhenDestroyed) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		{
+			LatencyRecorder recorder(histogram);
+			test::Sleep(5);
+
+			// Sanity:
+			EXPECT_EQ(0u, histogram.count());
+		}
+
+		// Assert:
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_LE(5'000u, histogram.max());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,226 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ReadMostlyValue.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ReadMostlyValueTests
+
+	namespace {
+		using Values = std::vector<int>;
+		using ReadMostlyValues = ReadMostlyValue<Values>;
+
+		struct DestructionCounter {
+		public:
+			explicit DestructionCounter(std::atomic<size_t>& numDestructions) : m_numDestructions(numDestructions)
+			{}
+
+			DestructionCounter(const DestructionCounter& rhs) : m_numDestructions(rhs.m_numDestructions)
+			{}
+
+			~DestructionCounter() {
+				++m_numDestructions;
+			}
+
+		private:
+			std::atomic<size_t>& m_numDestructions;
+		};
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CanCreateValue) {
+		// Act:
+		ReadMostlyValues value{ Values{ 1, 4, 9 } };
+
+		// Assert:
+		EXPECT_EQ(Values({ 1, 4, 9 }), *value.view());
+		EXPECT_EQ(0u, value.numPendingVersions());
+	}
+
+	TEST(TEST_CLASS, ModifierChangesArePublishedWhenModifierIsDestroyed) {
+		// Arrange:
+		ReadMostlyValues value{ Values{ 1, 4, 9 } };
+
+		// Act:
+		{
+			auto modifier = value.modifier();
+			modifier->push_back(16);
+
+			// Assert: changes are not visible while modifier is active
+			EXPECT_EQ(Values({ 1, 4, 9 }), *value.view());
+		}
+
+		// Assert:
+		EXPECT_EQ(Values({ 1, 4, 9, 16 }), *value.view());
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesPublishedAfterViewIsCreated) {
+		// Arrange:
+		ReadMostlyValues value{ Values{ 1, 4, 9 } };
+		auto view = value.view();
+
+		// Act:
+		value.modifier()->push_back(16);
+
+		// Assert:
+		EXPECT_EQ(Values({ 1, 4, 9 }), *view);
+		EXPECT_EQ(3u, view->size());
+		EXPECT_EQ(Values({ 1, 4, 9, 16 }), *value.view());
+	}
+
+	TEST(TEST_CLASS, MovedModifierPublishesChangesOnce) {
+		// Arrange:
+		ReadMostlyValues value{ Values{ 1, 4, 9 } };
+
+		// Act:
+		{
+			auto modifier = value.modifier();
+			auto movedModifier = std::move(modifier);
+			movedModifier->push_back(16);
+		}
+
+		// Assert:
+		EXPECT_EQ(Values({ 1, 4, 9, 16 }), *value.view());
+		EXPECT_EQ(0u, value.numPendingVersions());
+	}
+
+	// endregion
+
+	// region reclamation
+
+	TEST(TEST_CLASS, ReplacedVersionIsReclaimedImmediatelyWhenItIsNotObserved) {
+		// Arrange:
+		std::atomic<size_t> numDestructions(0);
+		ReadMostlyValue<DestructionCounter> value(numDestructions);
+
+		// Act:
+		{
+			auto modifier = value.modifier();
+		}
+
+		// Assert:
+		EXPECT_EQ(1u, numDestructions);
+		EXPECT_EQ(0u, value.numPendingVersions());
+	}
+
+	TEST(TEST_CLASS, ReplacedVersionIsNotReclaimedWhileItIsObserved) {
+		// Arrange:
+		std::atomic<size_t> numDestructions(0);
+		ReadMostlyValue<DestructionCounter> value(numDestructions);
+
+		{
+			auto view = value.view();
+
+			// Act:
+			value.modifier();
+
+			// Assert:
+			EXPECT_EQ(0u, numDestructions);
+			EXPECT_EQ(1u, value.numPendingVersions());
+		}
+
+		// Act: the replaced version is reclaimed by the next modification
+		value.modifier();
+
+		// Assert:
+		EXPECT_EQ(2u, numDestructions);
+		EXPECT_EQ(0u, value.numPendingVersions());
+	}
+
+	TEST(TEST_CLASS, DestructorDestroysAllVersions) {
+		// Arrange:
+		std::atomic<size_t> numDestructions(0);
+		{
+			ReadMostlyValue<DestructionCounter> value(numDestructions);
+			auto view = value.view();
+			value.modifier();
+
+			// Sanity:
+			EXPECT_EQ(0u, numDestructions);
+		}
+
+		// Assert: the replaced and the current version were destroyed
+		EXPECT_EQ(2u, numDestructions);
+	}
+
+	// endregion
+
+	// region synchronize
+
+	TEST(TEST_CLASS, SynchronizeBlocksUntilViewsAreDestroyed) {
+		// Arrange:
+		ReadMostlyValues value{ Values{ 1, 4, 9 } };
+
+		// Assert:
+		test::AssertExclusiveLocks(
+				[&value]() { return value.view(); },
+				[&value]() { value.synchronize(); });
+	}
+
+	// endregion
+
+	// region synchronization
+
+	namespace {
+		auto CreateLockProvider() {
+			return std::make_unique<ReadMostlyValues>();
+		}
+	}
+
+	DEFINE_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS)
+
+	TEST(TEST_CLASS, ConcurrentViewsAlwaysSeeConsistentVersions) {
+		// Arrange: each version contains all integers in [0, size)
+		constexpr auto Num_Modifications = 500u;
+		ReadMostlyValues value;
+		std::atomic_bool isDone(false);
+		std::atomic<size_t> numInconsistentViews(0);
+
+		// Act: read the value on multiple threads while it is being modified
+		boost::thread_group threads;
+		for (auto i = 0u; i < test::Num_Default_Lock_Threads; ++i) {
+			threads.create_thread([&value, &isDone, &numInconsistentViews]() {
+				while (!isDone) {
+					auto view = value.view();
+					for (auto j = 0u; j < view->size(); ++j) {
+						if (static_cast<int>(j) != (*view)[j])
+							++numInconsistentViews;
+					}
+				}
+			});
+		}
+
+		for (auto i = 0u; i < Num_Modifications; ++i)
+			value.modifier()->push_back(static_cast<int>(i));
+
+		isDone = true;
+		threads.join_all();
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentViews);
+		EXPECT_EQ(Num_Modifications, value.view()->size());
+	}
+
+	// endregion
+}}
@@ -83,4 +83,19 @@ namespace catapult { namespace utils {
 			return true;
 		});
 	}
+
+	TEST(TEST_CLASS, ElapsedMicrosIncreasesOverTime) {
+		// Arrange:
+		StackTimer stackTimer;
+
+		// Act:
+		test::Sleep(5);
+		auto elapsedMicros1 = stackTimer.micros();
+		test::Sleep(10);
+		auto elapsedMicros2 = stackTimer.micros();
+
+		// Assert:
+		EXPECT_LE(5'000u, elapsedMicros1);
+		EXPECT_LE(elapsedMicros1 + 10'000, elapsedMicros2);
+	}
 }}
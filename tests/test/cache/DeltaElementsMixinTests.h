@@ -121,6 +121,43 @@ namespace catapult { namespace test {
 				AssertMultipleMarkedElementsCanBeTrackedUnordered(*delta);
 		}
 
+		static void AssertOriginalElementsContainOnlyModifiedAndRemovedElements() {
+			// Arrange:
+			CacheType cache;
+			auto delta = cache.createDelta();
+			for (uint8_t i = 100; i < 105; ++i)
+				delta->insert(TTraits::CreateWithId(i));
+
+			cache.commit();
+
+			// Act:
+			std::set<IdType> expectedIds;
+			if (TModificationPolicy::Is_Strictly_Ordered) {
+				// - add one and remove it along with the last original element
+				delta->insert(TTraits::CreateWithId(105));
+				delta->remove(TTraits::MakeId(105));
+				delta->remove(TTraits::MakeId(104));
+				expectedIds.insert(TTraits::MakeId(104));
+			} else {
+				// - add one, modify one and remove one (if elements are immutable, no modifications are possible)
+				delta->insert(TTraits::CreateWithId(123));
+				TModificationPolicy::Modify(*delta, TTraits::CreateWithId(101));
+				delta->remove(TTraits::MakeId(103));
+				expectedIds = SelectIfMutable({ TTraits::MakeId(101) });
+				expectedIds.insert(TTraits::MakeId(103));
+			}
+
+			auto originalElements = delta->originalElements();
+
+			// Assert: only original values of changed elements are returned
+			std::set<IdType> ids;
+			for (const auto& element : originalElements)
+				ids.insert(TTraits::GetId(element));
+
+			EXPECT_EQ(expectedIds.size(), originalElements.size());
+			EXPECT_EQ(expectedIds, ids);
+		}
+
 	private:
 		template<typename TDelta>
 		static void AssertMultipleMarkedElementsCanBeTrackedOrdered(TDelta& delta) {
@@ -211,7 +248,8 @@ namespace catapult { namespace test {
 	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, AddedElementsAreMarkedAsAdded) \
 	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, ModifiedElementsAreMarkedAsModified) \
 	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, RemovedElementsAreMarkedAsRemoved) \
-	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, MultipleMarkedElementsCanBeTracked)
+	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, MultipleMarkedElementsCanBeTracked) \
+	MAKE_DELTA_ELEMENTS_MIXIN_TEST(TRAITS_NAME, POSTFIX, MODIFICATION_POLICY, OriginalElementsContainOnlyModifiedAndRemovedElements)
 
 #define DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(TRAITS_NAME, POSTFIX) \
 	DEFINE_DELTA_ELEMENTS_MIXIN_CUSTOM_TESTS(TRAITS_NAME, test::DeltaInsertModificationPolicy, POSTFIX)
@@ -374,6 +374,11 @@ namespace catapult { namespace test {
 			return { &m_elements[1], &m_elements[3] };
 		}
 
+		/// Gets copies of the original values of all modified and removed elements.
+		std::vector<uint64_t> originalElements() const {
+			return { m_elements[2], m_elements[1], m_elements[3] };
+		}
+
 	private:
 		uint64_t m_id;
 		std::array<uint64_t, 4> m_elements;
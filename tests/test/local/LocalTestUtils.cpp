@@ -69,6 +69,7 @@ namespace catapult { namespace test {
 
 			config.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromMegabytes(5);
 			config.MaxTrackedNodes = 5'000;
+			config.PublicKeyPointCacheMaxSize = 1'000;
 
 			config.Local.Host = "127.0.0.1";
 			config.Local.FriendlyName = "LOCAL";
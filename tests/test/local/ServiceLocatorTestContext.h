@@ -27,6 +27,7 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/utils/LatencyHistogramRegistry.h"
 #include "catapult/utils/NetworkTime.h"
 #include "tests/test/core/SchedulerTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
@@ -68,6 +69,7 @@ namespace catapult { namespace test {
 						m_stateChangeSubscriber,
 						m_nodeSubscriber,
 						m_counters,
+						m_latencyHistograms,
 						m_pluginManager,
 						m_pool)
 		{}
@@ -104,6 +106,11 @@ namespace catapult { namespace test {
 			return m_counters;
 		}
 
+		/// Gets the latency histograms.
+		auto& latencyHistograms() {
+			return m_latencyHistograms;
+		}
+
 		/// Gets the plugin manager.
 		auto& pluginManager() {
 			return m_pluginManager;
@@ -122,6 +129,7 @@ namespace catapult { namespace test {
 		mocks::MockNodeSubscriber m_nodeSubscriber;
 
 		std::vector<utils::DiagnosticCounter> m_counters;
+		utils::LatencyHistogramRegistry m_latencyHistograms;
 		plugins::PluginManager m_pluginManager;
 		thread::MultiServicePool m_pool;
 
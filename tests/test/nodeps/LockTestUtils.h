@@ -224,6 +224,27 @@ namespace catapult { namespace test {
 		EXPECT_EQ(1, flag);
 	}
 
+	/// Asserts that the lock obtained by \a acquireFirstLock does not prevent the lock obtained by \a acquireSecondLock
+	/// from being acquired.
+	template<typename TAcquireFirstLockFunc, typename TAcquireSecondLockFunc>
+	void AssertNonExclusiveLocks(TAcquireFirstLockFunc acquireFirstLock, TAcquireSecondLockFunc acquireSecondLock) {
+		// Arrange: get the first lock
+		auto pFlag = std::make_shared<std::atomic<int>>(0);
+		auto lock1 = acquireFirstLock();
+
+		// Act: spawn another thread to acquire the second lock
+		std::thread([pFlag, acquireSecondLock]() {
+			acquireSecondLock();
+			*pFlag = 1;
+		}).detach();
+
+		// - wait for the flag value to change while the first lock is still held
+		WAIT_FOR_EXPR(0 != *pFlag);
+
+		// Assert: the other thread acquired the (second) lock
+		EXPECT_EQ(1, *pFlag);
+	}
+
 	/// Asserts that \a provider view blocks a modifier.
 	template<typename TProvider>
 	void AssertModifierIsBlockedByView(TProvider&& provider) {
@@ -251,6 +272,24 @@ namespace catapult { namespace test {
 			[&provider]() { return provider.modifier(); });
 	}
 
+	/// Asserts that \a provider view does not block a modifier.
+	template<typename TProvider>
+	void AssertModifierIsNotBlockedByView(TProvider&& provider) {
+		// Assert:
+		AssertNonExclusiveLocks(
+			[&provider]() { return provider.view(); },
+			[&provider]() { return provider.modifier(); });
+	}
+
+	/// Asserts that \a provider modifier does not block a view.
+	template<typename TProvider>
+	void AssertViewIsNotBlockedByModifier(TProvider&& provider) {
+		// Assert:
+		AssertNonExclusiveLocks(
+			[&provider]() { return provider.modifier(); },
+			[&provider]() { return provider.view(); });
+	}
+
 /// Adds all view/modifier lock provider tests to the specified test class (\a TEST_CLASS).
 #define DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS) \
 	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) { test::AssertMultipleViewsCanBeAcquired(*CreateLockProvider()); } \
@@ -258,5 +297,13 @@ namespace catapult { namespace test {
 	TEST(TEST_CLASS, ViewIsBlockedByModifier) { test::AssertViewIsBlockedByModifier(*CreateLockProvider()); } \
 	TEST(TEST_CLASS, ModifierIsBlockedByModifier) { test::AssertModifierIsBlockedByModifier(*CreateLockProvider()); }
 
+/// Adds all view/modifier snapshot provider tests to the specified test class (\a TEST_CLASS).
+/// \note Snapshot providers have views that are backed by immutable snapshots and only modifiers are exclusive.
+#define DEFINE_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS) \
+	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) { test::AssertMultipleViewsCanBeAcquired(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ModifierIsNotBlockedByView) { test::AssertModifierIsNotBlockedByView(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ViewIsNotBlockedByModifier) { test::AssertViewIsNotBlockedByModifier(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ModifierIsBlockedByModifier) { test::AssertModifierIsBlockedByModifier(*CreateLockProvider()); }
+
 	// endregion
 }}
@@ -50,7 +50,23 @@ namespace catapult { namespace test {
 			using SetType = TSet;
 			using MemorySetType = SetType;
 
+			/// Result of an original element lookup.
+			struct OriginalFindResult {
+			public:
+				/// Gets a pointer to the found element or \c nullptr if no element was found.
+				const typename SetType::mapped_type* get() const {
+					return pElement;
+				}
+
+			public:
+				/// Found element.
+				const typename SetType::mapped_type* pElement;
+			};
+
 		public:
+			/// Original elements.
+			SetType Original;
+
 			/// Added elements.
 			SetType Added;
 
@@ -65,6 +81,12 @@ namespace catapult { namespace test {
 			auto deltas() const {
 				return deltaset::DeltaElements<SetType>(Added, Removed, Copied);
 			}
+
+			/// Searches for \a key in the original elements.
+			OriginalFindResult findOriginal(const typename SetType::key_type& key) const {
+				auto iter = Original.find(key);
+				return { Original.cend() == iter ? nullptr : &iter->second };
+			}
 		};
 
 		/// Mixin that provides generational change emulation.
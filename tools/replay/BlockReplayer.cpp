@@ -0,0 +1,209 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockReplayer.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockStatisticCache.h"
+#include "catapult/cache_core/ImportanceView.h"
+#include "catapult/chain/BlockScorer.h"
+#include "catapult/chain/ChainUtils.h"
+#include "catapult/config/CatapultConfiguration.h"
+#include "catapult/consumers/BlockChainSyncHandlers.h"
+#include "catapult/consumers/BlockConsumers.h"
+#include "catapult/crypto/PublicKeyPointCache.h"
+#include "catapult/disruptor/ConsumerInput.h"
+#include "catapult/extensions/ExecutionConfigurationFactory.h"
+#include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/MemoryBlockStorage.h"
+#include "catapult/extensions/NemesisBlockLoader.h"
+#include "catapult/extensions/PluginUtils.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/utils/StackTimer.h"
+#include "catapult/validators/ParallelValidationPolicy.h"
+
+namespace catapult { namespace tools { namespace replay {
+
+	namespace {
+		// region timings
+
+		// processing stages that are nested within the block chain sync consumer
+		struct SyncTimings {
+			uint64_t ExecuteMicros = 0;
+			uint64_t ProcessMicros = 0;
+		};
+
+		// endregion
+
+		// region pipeline
+
+		consumers::BlockChainProcessor CreateTimedProcessor(
+				const model::BlockChainConfiguration& blockChainConfig,
+				const plugins::PluginManager& pluginManager,
+				SyncTimings& syncTimings) {
+			auto batchEntityProcessor = chain::CreateBatchEntityProcessor(extensions::CreateExecutionConfiguration(pluginManager));
+			auto timedBatchEntityProcessor = [batchEntityProcessor, &syncTimings](
+					auto height,
+					auto timestamp,
+					const auto& entityInfos,
+					auto& observerState) {
+				utils::StackTimer timer;
+				auto result = batchEntityProcessor(height, timestamp, entityInfos, observerState);
+				syncTimings.ExecuteMicros += timer.micros();
+				return result;
+			};
+
+			consumers::BlockHitPredicateFactory blockHitPredicateFactory = [&blockChainConfig](const auto& cache) {
+				cache::ImportanceView view(cache.template sub<cache::AccountStateCache>());
+				return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
+					return view.getAccountImportanceOrDefault(publicKey, height);
+				});
+			};
+
+			auto receiptValidationMode = blockChainConfig.EnableVerifiableReceipts
+					? consumers::ReceiptValidationMode::Enabled
+					: consumers::ReceiptValidationMode::Disabled;
+			auto processor = consumers::CreateBlockChainProcessor(blockHitPredicateFactory, timedBatchEntityProcessor, receiptValidationMode);
+			return [processor, &syncTimings](const auto& parentBlockInfo, auto& blockElements, auto& observerState) {
+				utils::StackTimer timer;
+				auto result = processor(parentBlockInfo, blockElements, observerState);
+				syncTimings.ProcessMicros += timer.micros();
+				return result;
+			};
+		}
+
+		consumers::BlockChainSyncHandlers CreateReplaySyncHandlers(
+				const model::BlockChainConfiguration& blockChainConfig,
+				const plugins::PluginManager& pluginManager,
+				SyncTimings& syncTimings) {
+			consumers::BlockChainSyncHandlers syncHandlers;
+			syncHandlers.DifficultyChecker = [&blockChainConfig](const auto& blocks, const cache::CatapultCache& cache) {
+				return blocks.size() == chain::CheckDifficulties(cache.sub<cache::BlockStatisticCache>(), blocks, blockChainConfig);
+			};
+			syncHandlers.UndoBlock = [](const auto&, auto&, auto) {
+				// replayed blocks always extend the local chain, so a rollback indicates a corrupt source chain
+				CATAPULT_THROW_RUNTIME_ERROR("replay does not support rollbacks");
+			};
+			syncHandlers.Processor = CreateTimedProcessor(blockChainConfig, pluginManager, syncTimings);
+			syncHandlers.StateChange = [](const auto&) {};
+			syncHandlers.PreStateWritten = [](const auto&, auto) {};
+			syncHandlers.TransactionsChange = [](const auto&) {};
+			syncHandlers.CommitStep = [](auto) {};
+			return syncHandlers;
+		}
+
+		std::vector<disruptor::DisruptorConsumer> CreateBlockConsumers(
+				const config::CatapultConfiguration& config,
+				const plugins::PluginManager& pluginManager,
+				const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
+			const auto& generationHash = config.BlockChain.Network.GenerationHash;
+			auto requiresValidationPredicate = [](auto, auto, const auto&) { return true; };
+			auto pValidationPolicy = validators::CreateParallelValidationPolicy(
+					pValidatorPool,
+					extensions::CreateStatelessEntityValidator(pluginManager, model::SignatureNotification::Notification_Type));
+
+			return disruptor::DisruptorConsumersFromBlockConsumers({
+				consumers::CreateBlockHashCalculatorConsumer(generationHash, pluginManager.transactionRegistry(), pValidatorPool),
+				consumers::CreateBlockStatelessValidationConsumer(pValidationPolicy, requiresValidationPredicate),
+				consumers::CreateBlockBatchSignatureConsumer(
+						generationHash,
+						pluginManager.createNotificationPublisher(),
+						pValidatorPool,
+						std::make_shared<crypto::PublicKeyPointCache>(config.Node.PublicKeyPointCacheMaxSize),
+						requiresValidationPredicate)
+			});
+		}
+
+		disruptor::ConsumerInput CreateConsumerInput(const model::Block& block) {
+			auto range = model::BlockRange::CopyVariable(reinterpret_cast<const uint8_t*>(&block), block.Size, { 0 });
+			return disruptor::ConsumerInput(std::move(range), disruptor::InputSource::Local);
+		}
+
+		// endregion
+	}
+
+	ReplayResult ReplayBlocks(
+			const config::CatapultConfiguration& config,
+			const plugins::PluginManager& pluginManager,
+			const std::shared_ptr<thread::IoThreadPool>& pValidatorPool,
+			const io::BlockStorage& sourceStorage,
+			Height maxHeight) {
+		// 1. seed fresh state with the source nemesis block
+		auto pNemesisBlockElement = sourceStorage.loadBlockElement(Height(1));
+		io::BlockStorageCache storage(
+				std::make_unique<extensions::MemoryBlockStorage>(*pNemesisBlockElement),
+				std::make_unique<extensions::MemoryBlockStorage>(*pNemesisBlockElement));
+		auto cache = pluginManager.createCache();
+		extensions::LocalNodeChainScore score;
+		{
+			auto cacheDelta = cache.createDelta();
+			extensions::NemesisBlockLoader loader(cacheDelta, pluginManager, pluginManager.createObserver());
+			loader.executeAndCommit(extensions::LocalNodeStateRef(config, cache, storage, score));
+		}
+
+		// 2. prepare the consumer pipeline
+		SyncTimings syncTimings;
+		auto consumers = CreateBlockConsumers(config, pluginManager, pValidatorPool);
+		consumers.push_back(consumers::CreateBlockChainSyncConsumer(
+				cache,
+				storage,
+				config.BlockChain.MaxRollbackBlocks,
+				CreateReplaySyncHandlers(config.BlockChain, pluginManager, syncTimings)));
+
+		// 3. replay all blocks one by one
+		ReplayResult result;
+		std::vector<uint64_t> consumerMicros(consumers.size(), 0);
+		utils::StackTimer replayTimer;
+		for (auto height = Height(2); height <= maxHeight; height = height + Height(1)) {
+			auto input = CreateConsumerInput(*sourceStorage.loadBlock(height));
+			result.NumTransactions += input.blocks()[0].Transactions.size();
+
+			for (auto i = 0u; i < consumers.size(); ++i) {
+				utils::StackTimer consumerTimer;
+				auto consumerResult = consumers[i](input);
+				consumerMicros[i] += consumerTimer.micros();
+
+				if (disruptor::CompletionStatus::Aborted == consumerResult.CompletionStatus) {
+					auto validationResult = static_cast<validators::ValidationResult>(consumerResult.CompletionCode);
+					CATAPULT_THROW_RUNTIME_ERROR_2("replay aborted at height", height, validationResult);
+				}
+			}
+
+			++result.NumBlocks;
+		}
+
+		result.ElapsedMicros = replayTimer.micros();
+
+		// 4. break down the sync consumer time into its nested stages
+		result.StageTimings = {
+			{ "hash calculation", consumerMicros[0] },
+			{ "stateless validation", consumerMicros[1] },
+			{ "batch signature", consumerMicros[2] },
+			{ "stateful validation + observers", syncTimings.ExecuteMicros },
+			{ "block checks + state hash", syncTimings.ProcessMicros - syncTimings.ExecuteMicros },
+			{ "difficulty check + commit", consumerMicros[3] - syncTimings.ProcessMicros }
+		};
+		return result;
+	}
+}}}
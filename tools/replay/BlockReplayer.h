@@ -0,0 +1,69 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult {
+	namespace config { class CatapultConfiguration; }
+	namespace io { class BlockStorage; }
+	namespace plugins { class PluginManager; }
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace tools { namespace replay {
+
+	/// Time spent in a single replay stage.
+	struct ReplayStageTiming {
+		/// Stage name.
+		std::string Name;
+
+		/// Total elapsed time (in microseconds).
+		uint64_t ElapsedMicros;
+	};
+
+	/// Result of a replay.
+	struct ReplayResult {
+		/// Number of replayed blocks.
+		uint64_t NumBlocks = 0;
+
+		/// Number of replayed transactions.
+		uint64_t NumTransactions = 0;
+
+		/// Total elapsed time (in microseconds).
+		uint64_t ElapsedMicros = 0;
+
+		/// Per stage timings.
+		std::vector<ReplayStageTiming> StageTimings;
+	};
+
+	/// Replays blocks with heights in the range [2, \a maxHeight] loaded from \a sourceStorage through the block consumer pipeline.
+	/// State is created by \a pluginManager using \a config and seeded with the nemesis block loaded from \a sourceStorage.
+	/// \a pValidatorPool is used for hash calculation, stateless validation and signature verification.
+	ReplayResult ReplayBlocks(
+			const config::CatapultConfiguration& config,
+			const plugins::PluginManager& pluginManager,
+			const std::shared_ptr<thread::IoThreadPool>& pValidatorPool,
+			const io::BlockStorage& sourceStorage,
+			Height maxHeight);
+}}}
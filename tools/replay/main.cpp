@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "BlockReplayer.h"
+#include "tools/ToolConfigurationUtils.h"
+#include "tools/ToolThreadUtils.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/plugins/PluginLoader.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoThreadPool.h"
+#include <boost/filesystem.hpp>
+#include <iomanip>
+
+namespace catapult { namespace tools { namespace replay {
+
+	namespace {
+		plugins::StorageConfiguration CreateStorageConfiguration(bool useCacheDatabase, const std::string& workDirectory) {
+			plugins::StorageConfiguration storageConfig;
+			storageConfig.PreferCacheDatabase = useCacheDatabase;
+			storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(workDirectory) / "statedb").generic_string();
+			return storageConfig;
+		}
+
+		uint64_t PerSecond(uint64_t count, uint64_t elapsedMicros) {
+			return 0 == elapsedMicros ? 0 : count * 1'000'000 / elapsedMicros;
+		}
+
+		void LogResult(const ReplayResult& result) {
+			std::ostringstream out;
+			out
+					<< "replayed " << result.NumBlocks << " blocks with " << result.NumTransactions << " transactions in "
+					<< result.ElapsedMicros / 1000 << "ms" << std::endl
+					<< " + " << PerSecond(result.NumBlocks, result.ElapsedMicros) << " blocks/s" << std::endl
+					<< " + " << PerSecond(result.NumTransactions, result.ElapsedMicros) << " transactions/s" << std::endl
+					<< "--- stages ---";
+
+			for (const auto& stageTiming : result.StageTimings) {
+				auto percentage = 0 == result.ElapsedMicros ? 0 : stageTiming.ElapsedMicros * 100 / result.ElapsedMicros;
+				auto microsPerBlock = 0 == result.NumBlocks ? 0 : stageTiming.ElapsedMicros / result.NumBlocks;
+				out
+						<< std::endl << std::setw(32) << stageTiming.Name << " : "
+						<< stageTiming.ElapsedMicros / 1000 << "ms (" << percentage << "%, " << microsPerBlock << "us/block)";
+			}
+
+			CATAPULT_LOG(info) << out.str();
+		}
+
+		class ReplayTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Replay Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("resources,r",
+						OptionsValue<std::string>(m_resourcesPath)->default_value(".."),
+						"the path to the resources directory");
+
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory),
+						"the path to the data directory containing the blocks to replay (default: configured data directory)");
+
+				optionsBuilder("work,w",
+						OptionsValue<std::string>(m_workDirectory)->default_value("replay.tmp"),
+						"the path to a temporary directory that is created and destroyed by the tool");
+
+				optionsBuilder("count,c",
+						OptionsValue<uint64_t>(m_numBlocks)->default_value(0),
+						"the number of blocks to replay (0 replays all blocks)");
+
+				optionsBuilder("threads,t",
+						OptionsValue<uint32_t>(m_numValidatorThreads)->default_value(0),
+						"the number of validator threads (0 uses the default concurrency)");
+
+				optionsBuilder("useCacheDatabase,d",
+						OptionsSwitch(),
+						"true if state should be stored in a cache database instead of in memory");
+			}
+
+			int run(const Options& options) override {
+				auto config = LoadConfiguration(m_resourcesPath);
+				if (m_sourceDirectory.empty())
+					m_sourceDirectory = config.User.DataDirectory;
+
+				if (boost::filesystem::exists(m_workDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("temporary work directory must not exist", m_workDirectory);
+
+				boost::filesystem::create_directories(m_workDirectory);
+				auto result = replay(config, options["useCacheDatabase"].as<bool>());
+				boost::filesystem::remove_all(m_workDirectory);
+
+				LogResult(result);
+				return 0;
+			}
+
+		private:
+			ReplayResult replay(const config::CatapultConfiguration& config, bool useCacheDatabase) {
+				// 1. load all plugins (modules must outlive the plugin manager)
+				plugins::PluginModules pluginModules;
+				plugins::PluginManager pluginManager(
+						config.BlockChain,
+						CreateStorageConfiguration(useCacheDatabase, m_workDirectory),
+						config.User,
+						config.Inflation);
+				for (const auto& pluginName : { "catapult.plugins.coresystem", "catapult.plugins.signature" })
+					plugins::LoadPluginByName(pluginManager, pluginModules, config.User.PluginsDirectory, pluginName);
+
+				for (const auto& pair : config.BlockChain.Plugins)
+					plugins::LoadPluginByName(pluginManager, pluginModules, config.User.PluginsDirectory, pair.first);
+
+				// 2. determine the replay range
+				io::FileBlockStorage sourceStorage(m_sourceDirectory);
+				auto maxHeight = sourceStorage.chainHeight();
+				if (0 != m_numBlocks)
+					maxHeight = std::min(maxHeight, Height(m_numBlocks + 1));
+
+				auto numValidatorThreads = 0 != m_numValidatorThreads ? m_numValidatorThreads : std::thread::hardware_concurrency();
+				CATAPULT_LOG(info)
+						<< "replaying blocks [2, " << maxHeight << "] from " << m_sourceDirectory
+						<< " with " << numValidatorThreads << " validator threads"
+						<< " (cache database " << (useCacheDatabase ? "enabled" : "disabled") << ")";
+
+				// 3. replay
+				auto pValidatorPool = CreateStartedThreadPool(numValidatorThreads);
+				auto result = ReplayBlocks(config, pluginManager, pValidatorPool, sourceStorage, maxHeight);
+				pValidatorPool->join();
+				return result;
+			}
+
+		private:
+			std::string m_resourcesPath;
+			std::string m_sourceDirectory;
+			std::string m_workDirectory;
+			uint64_t m_numBlocks;
+			uint32_t m_numValidatorThreads;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::replay::ReplayTool replayTool;
+	return catapult::tools::ToolMain(argc, argv, replayTool);
+}